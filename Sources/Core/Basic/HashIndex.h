@@ -0,0 +1,250 @@
+/**
+ * @file Core/Basic/HashIndex.h
+ * Contains the header of class Core::Basic::HashIndex.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/alusus_license_1_0>.
+ */
+//==============================================================================
+
+#ifndef CORE_BASIC_HASHINDEX_H
+#define CORE_BASIC_HASHINDEX_H
+
+namespace Core::Basic
+{
+
+/**
+ * @brief A hash index used to speed up searching by string keys.
+ * @ingroup basic_utils
+ *
+ * This template class indexes a string field of the records of a sequential
+ * array using an open addressing hash table with linear probing. Unlike
+ * SortedIndex, keys can be searched for using a pointer to the key's
+ * characters and its length, so searching never needs to allocate a temporary
+ * string. The order of the records within the array isn't affected.
+ *
+ * @tparam RECORD The type of the entire data record that contains the key.
+ * @tparam KEY The member pointer to the key within the data record.
+ */
+template<class RECORD, Str RECORD::*KEY> class HashIndex
+{
+  //============================================================================
+  // Types
+
+  /// A slot in the hash table. Empty slots have an index of -1.
+  private: struct Slot
+  {
+    Word hash;
+    Int index;
+  };
+
+
+  //============================================================================
+  // Member Variables
+
+  /// The targeted vector of records.
+  private: std::vector<RECORD> *records;
+
+  /// The hash table. Its size is always 0 or a power of 2.
+  private: std::vector<Slot> slots;
+
+  /// The number of indexed records.
+  private: Word count = 0;
+
+
+  //============================================================================
+  // Constructors
+
+  /// Initialize the object's variables and index the existing records.
+  public: HashIndex(std::vector<RECORD> *r) : records(r)
+  {
+    this->add();
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  /**
+   * @brief Add new items to the index.
+   * This has the same semantics as SortedIndex::add(). Adding items at the end
+   * of the records list is done in constant time while adding an item at a
+   * specific location requires rebuilding the index since the indices of the
+   * following items change.
+   * @param index If this value is -1, any items at the end of the records list
+   *              beyond the number of indexed items are added. Otherwise, the
+   *              item at index is new and the items following it were shifted.
+   */
+  public: void add(Int index=-1)
+  {
+    if (index == -1) {
+      while (this->records->size() > this->count) this->insertSlot(this->count);
+    } else if (static_cast<Word>(index) < this->records->size()) {
+      if (static_cast<Word>(index) == this->count) this->insertSlot(index);
+      else this->rebuild();
+    } else {
+      throw EXCEPTION(InvalidArgumentException, S("index"), S("Out of range."), index);
+    }
+  }
+
+  /**
+   * @brief Remove the given index from the index.
+   * Unlike SortedIndex, this function must be called before the record is
+   * removed from the records list. Removing the last item is done in constant
+   * time while removing other items requires rebuilding the index since the
+   * indices of the following items change.
+   * @param index The index of the record being removed.
+   */
+  public: void remove(Int index)
+  {
+    if (index < 0 || static_cast<Word>(index) >= this->count) {
+      throw EXCEPTION(InvalidArgumentException, S("index"), S("Out of range."), index);
+    }
+    if (static_cast<Word>(index) == this->count - 1) {
+      this->eraseSlot(this->findSlot(index));
+      --this->count;
+    } else {
+      this->rebuild(index);
+    }
+  }
+
+  /**
+   * @brief Clear the entire index.
+   * This does not affect the original records, only the index.
+   */
+  public: void clear()
+  {
+    this->slots.clear();
+    this->count = 0;
+  }
+
+  /**
+   * @brief Search for the given key.
+   * @return The index of the found record, or -1 otherwise.
+   */
+  public: Int find(Char const *key) const
+  {
+    Word hash = 2166136261u;
+    Char const *c = key;
+    for (; *c != 0; ++c) hash = HashIndex::hashChar(hash, *c);
+    return this->find(key, c - key, hash);
+  }
+
+  /**
+   * @brief Search for the given key.
+   * @param key A pointer to the characters of the key, which doesn't need to
+   *            be null terminated.
+   * @param length The number of characters in the key.
+   * @return The index of the found record, or -1 otherwise.
+   */
+  public: Int find(Char const *key, Word length) const
+  {
+    return this->find(key, length, HashIndex::hash(key, length));
+  }
+
+  private: Int find(Char const *key, Word length, Word hash) const
+  {
+    if (this->slots.empty()) return -1;
+    Word mask = this->slots.size() - 1;
+    for (Word pos = hash & mask; this->slots[pos].index != -1; pos = (pos + 1) & mask) {
+      if (this->slots[pos].hash != hash) continue;
+      Str const &k = (*this->records)[this->slots[pos].index].*KEY;
+      if (k.size() == length && memcmp(k.c_str(), key, length) == 0) return this->slots[pos].index;
+    }
+    return -1;
+  }
+
+  /// Compute the FNV-1a hash of the given characters.
+  private: static Word hash(Char const *key, Word length)
+  {
+    Word hash = 2166136261u;
+    for (Word i = 0; i < length; ++i) hash = HashIndex::hashChar(hash, key[i]);
+    return hash;
+  }
+
+  private: static Word hashChar(Word hash, Char c)
+  {
+    return (hash ^ static_cast<unsigned char>(c)) * 16777619u;
+  }
+
+  /// Add the record following the indexed records to the hash table, growing the table if needed.
+  private: void insertSlot(Int index)
+  {
+    ASSERT(static_cast<Word>(index) == this->count);
+    if ((this->count + 1) * 2 > this->slots.size()) {
+      this->rebuild();
+      return;
+    }
+    ++this->count;
+    Str const &key = this->records->at(index).*KEY;
+    Word hash = HashIndex::hash(key.c_str(), key.size());
+    Word mask = this->slots.size() - 1;
+    Word pos = hash & mask;
+    while (this->slots[pos].index != -1) pos = (pos + 1) & mask;
+    this->slots[pos] = { hash, index };
+  }
+
+  /// Find the slot holding the given record index.
+  private: Word findSlot(Int index) const
+  {
+    Str const &key = this->records->at(index).*KEY;
+    Word mask = this->slots.size() - 1;
+    Word pos = HashIndex::hash(key.c_str(), key.size()) & mask;
+    while (this->slots[pos].index != index) pos = (pos + 1) & mask;
+    return pos;
+  }
+
+  /**
+   * @brief Empty the given slot.
+   * The following slots of the same probe sequence are shifted back so that
+   * searches don't stop at the emptied slot.
+   */
+  private: void eraseSlot(Word pos)
+  {
+    Word mask = this->slots.size() - 1;
+    Word next = pos;
+    while (true) {
+      next = (next + 1) & mask;
+      if (this->slots[next].index == -1) break;
+      Word home = this->slots[next].hash & mask;
+      // Only move the slot if its home position isn't between the emptied slot and its current position.
+      Bool between = pos <= next ? (pos < home && home <= next) : (pos < home || home <= next);
+      if (!between) {
+        this->slots[pos] = this->slots[next];
+        pos = next;
+      }
+    }
+    this->slots[pos].index = -1;
+  }
+
+  /**
+   * @brief Recreate the hash table for all the records.
+   * @param removedIndex The index of a record that is about to be removed and
+   *                     should be skipped, or -1 to index all records.
+   */
+  private: void rebuild(Int removedIndex = -1)
+  {
+    this->count = this->records->size();
+    if (removedIndex != -1) --this->count;
+    Word size = 8;
+    while (size < this->count * 2) size *= 2;
+    this->slots.assign(size, { 0, -1 });
+    Word mask = size - 1;
+    for (Int i = 0; static_cast<Word>(i) < this->records->size(); ++i) {
+      if (i == removedIndex) continue;
+      Str const &key = this->records->at(i).*KEY;
+      Word hash = HashIndex::hash(key.c_str(), key.size());
+      Word pos = hash & mask;
+      while (this->slots[pos].index != -1) pos = (pos + 1) & mask;
+      this->slots[pos] = { hash, removedIndex != -1 && i > removedIndex ? i - 1 : i };
+    }
+  }
+
+}; // class
+
+} // namespace
+
+#endif
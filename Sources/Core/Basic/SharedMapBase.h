@@ -36,8 +36,8 @@ template<class CTYPE, class PTYPE> class SharedMapBase : public PTYPE, public Dy
    */
   private: typedef std::pair<Str, SharedPtr<CTYPE>> Entry;
 
-  /// The type for the sorted index used to index the string key of the list.
-  private: typedef DirectSortedIndex<Entry, Str, &Entry::first> Index;
+  /// The type for the hash index used to index the string key of the list.
+  private: typedef HashIndex<Entry, &Entry::first> Index;
 
 
   //============================================================================
@@ -78,9 +78,9 @@ template<class CTYPE, class PTYPE> class SharedMapBase : public PTYPE, public Dy
 
   /**
    * @brief Create the index, if required.
-   * If useIndex is true, a sorted index will be created to speed up
+   * If useIndex is true, a hash index will be created to speed up
    * searching, otherwise the object will use sequential searching instead of
-   * binary search.
+   * hash lookups.
    */
   protected: SharedMapBase(Bool useIndex = false) : inherited(0), base(0)
   {
@@ -232,9 +232,9 @@ template<class CTYPE, class PTYPE> class SharedMapBase : public PTYPE, public Dy
     if (myIndex != -1 && myIndex != index) {
       obj = this->get(myIndex);
       this->prepareForUnset(key, myIndex, this->list[myIndex].second, this->inherited->at(myIndex));
+      if (this->index != 0) this->index->remove(myIndex);
       this->list.erase(this->list.begin()+myIndex);
       this->inherited->erase(this->inherited->begin()+myIndex);
-      if (this->index != 0) this->index->remove(myIndex);
       this->onRemoved(myIndex);
       obj = this->prepareForSet(key, index, obj, true, true);
       this->list.insert(this->list.begin()+index, Entry(key, obj));
@@ -274,17 +274,17 @@ template<class CTYPE, class PTYPE> class SharedMapBase : public PTYPE, public Dy
     ASSERT(static_cast<Word>(index) < this->getBaseDefCount()+1);
     if (this->inherited->at(index)) {
       this->prepareForUnset(this->list[index].first.c_str(), index, this->list[index].second, true);
+      if (this->index != 0) this->index->remove(index);
       this->list.erase(this->list.begin()+index);
       this->inherited->erase(this->inherited->begin()+index);
-      if (this->index != 0) this->index->remove(index);
       this->onRemoved(index);
     } else {
       Str key = this->getKey(index);
       SharedPtr<CTYPE> obj = this->get(index);
       this->prepareForUnset(key.c_str(), index, obj, false);
+      if (this->index != 0) this->index->remove(index);
       this->list.erase(this->list.begin()+index);
       this->inherited->erase(this->inherited->begin()+index);
-      if (this->index != 0) this->index->remove(index);
       this->onRemoved(index);
       this->add(key.c_str(), obj);
     }
@@ -418,9 +418,9 @@ template<class CTYPE, class PTYPE> class SharedMapBase : public PTYPE, public Dy
     } else {
       this->onWillRemove(idx);
       this->prepareForUnset(key, idx, this->list[idx].second, false);
+      if (this->index != 0) this->index->remove(idx);
       this->list.erase(this->list.begin()+idx);
       if (this->inherited != 0) this->inherited->erase(this->inherited->begin()+idx);
-      if (this->index != 0) this->index->remove(idx);
       this->onRemoved(idx);
     }
     return idx;
@@ -447,9 +447,9 @@ template<class CTYPE, class PTYPE> class SharedMapBase : public PTYPE, public Dy
     } else {
       this->onWillRemove(index);
       this->prepareForUnset(this->list[index].first.c_str(), index, this->list[index].second, false);
+      if (this->index != 0) this->index->remove(index);
       this->list.erase(this->list.begin()+index);
       if (this->inherited != 0) this->inherited->erase(this->inherited->begin()+index);
-      if (this->index != 0) this->index->remove(index);
       this->onRemoved(index);
     }
   }
@@ -500,7 +500,7 @@ template<class CTYPE, class PTYPE> class SharedMapBase : public PTYPE, public Dy
     }
     // Do we have an index to speed up search?
     if (this->index != 0) {
-      return this->index->find(Str(key));
+      return this->index->find(key);
     } else {
       for (Word i = 0; i < this->list.size(); ++i) {
         if (this->list[i].first == key) return i;
@@ -509,6 +509,27 @@ template<class CTYPE, class PTYPE> class SharedMapBase : public PTYPE, public Dy
     }
   }
 
+  /**
+   * @brief Find the index of a key that isn't null terminated.
+   * @param key A pointer to the characters of the key.
+   * @param keyLength The number of characters in the key.
+   */
+  public: Int findIndex(Char const *key, Word keyLength) const
+  {
+    if (key == 0) {
+      throw EXCEPTION(InvalidArgumentException, S("key"), S("Cannot be null."));
+    }
+    if (this->index != 0) {
+      return this->index->find(key, keyLength);
+    } else {
+      for (Word i = 0; i < this->list.size(); ++i) {
+        Str const &k = this->list[i].first;
+        if (k.size() == keyLength && memcmp(k.c_str(), key, keyLength) == 0) return i;
+      }
+      return -1;
+    }
+  }
+
   public: void clear()
   {
     Int i = 0;
@@ -0,0 +1,167 @@
+/**
+ * @file Core/Basic/SlabAllocator.h
+ * Contains the header of classes Core::Basic::SlabPool and
+ * Core::Basic::SlabAllocator.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/alusus_license_1_0>.
+ */
+//==============================================================================
+
+#ifndef CORE_BASIC_SLABALLOCATOR_H
+#define CORE_BASIC_SLABALLOCATOR_H
+
+namespace Core::Basic
+{
+
+/**
+ * @brief A pool of memory blocks used to allocate objects of a single type.
+ * @ingroup basic_utils
+ *
+ * Blocks are carved out of slabs that each hold SLAB_BLOCK_COUNT blocks, so
+ * objects of the same type allocated together are placed next to each other
+ * in memory. Freed blocks are kept in a free list to be reused by later
+ * allocations of the same type rather than being returned to the system
+ * allocator.
+ *
+ * Each thread has its own free list and current slab, so no locking is
+ * needed. A block freed on a thread other than the one that allocated it
+ * simply joins the free list of the freeing thread. Slabs are never released,
+ * and the free blocks of a thread are abandoned when it exits, so this pool
+ * should only be used for types that are allocated in large numbers
+ * throughout the life of the process, like AST nodes.
+ *
+ * @tparam T The type of the objects allocated from this pool.
+ */
+template <class T> class SlabPool
+{
+  //============================================================================
+  // Types
+
+  private: union Block
+  {
+    Block *next;
+    alignas(T) Byte data[sizeof(T)];
+  };
+
+  /// The allocation state of a single thread.
+  private: struct ThreadState
+  {
+    Block *freeList = 0;
+    Block *slab = 0;
+    Word slabRemaining = 0;
+  };
+
+
+  //============================================================================
+  // Constants
+
+  public: static constexpr Word SLAB_BLOCK_COUNT = 64;
+
+
+  //============================================================================
+  // Member Functions
+
+  private: static ThreadState& getThreadState()
+  {
+    thread_local ThreadState state;
+    return state;
+  }
+
+  /// Allocate a memory block big enough for a single object of type T.
+  public: static void* allocate()
+  {
+    auto &state = SlabPool::getThreadState();
+    if (state.freeList != 0) {
+      auto block = state.freeList;
+      state.freeList = block->next;
+      return block;
+    }
+    if (state.slabRemaining == 0) {
+      state.slab = static_cast<Block*>(::operator new(sizeof(Block) * SLAB_BLOCK_COUNT));
+      state.slabRemaining = SLAB_BLOCK_COUNT;
+    }
+    --state.slabRemaining;
+    return state.slab++;
+  }
+
+  /// Return a block allocated by allocate() to the pool.
+  public: static void deallocate(void *ptr)
+  {
+    auto &state = SlabPool::getThreadState();
+    auto block = static_cast<Block*>(ptr);
+    block->next = state.freeList;
+    state.freeList = block;
+  }
+
+}; // class
+
+
+/**
+ * @brief A standard allocator that allocates single objects from a SlabPool.
+ * @ingroup basic_utils
+ *
+ * This is used with std::allocate_shared, which rebinds the allocator to the
+ * type of the block holding both the object and its reference counts, so each
+ * type gets its own pool and the object and its counts come from a single
+ * block. Arrays are allocated from the system allocator.
+ */
+template <class T> class SlabAllocator
+{
+  public: typedef T value_type;
+
+  public: SlabAllocator()
+  {
+  }
+
+  public: template <class U> SlabAllocator(SlabAllocator<U> const&)
+  {
+  }
+
+  public: T* allocate(std::size_t count)
+  {
+    if (count == 1) return static_cast<T*>(SlabPool<T>::allocate());
+    else return static_cast<T*>(::operator new(count * sizeof(T)));
+  }
+
+  public: void deallocate(T *ptr, std::size_t count)
+  {
+    if (count == 1) SlabPool<T>::deallocate(ptr);
+    else ::operator delete(ptr);
+  }
+
+  public: template <class U> Bool operator==(SlabAllocator<U> const&) const
+  {
+    return true;
+  }
+
+  public: template <class U> Bool operator!=(SlabAllocator<U> const&) const
+  {
+    return false;
+  }
+
+}; // class
+
+
+/**
+ * @brief Create a shared object of the given type.
+ * @ingroup basic_utils
+ *
+ * Types that set SLAB_ALLOCATED to true are allocated using SlabAllocator,
+ * while other types are allocated using std::make_shared.
+ */
+template <class T, class ...ARGS> SharedPtr<T> newSharedObject(ARGS&&... args)
+{
+  if constexpr (T::SLAB_ALLOCATED) {
+    return std::allocate_shared<T>(SlabAllocator<T>(), std::forward<ARGS>(args)...);
+  } else {
+    return std::make_shared<T>(std::forward<ARGS>(args)...);
+  }
+}
+
+} // namespace
+
+#endif
@@ -42,21 +42,4 @@ InterfaceTypeInfo * TiInterface::getTypeInfo()
 }
 
 
-/**
- * Check if this interface is of the given type, or a derived type.
- *
- * @return Returns true if the given type info is for the interface from which
- *         this interface is instantiated, or for the interface from which this
- *         interface's class is derived, false otherwise.
- */
-Bool TiInterface::isInterfaceDerivedFrom(TypeInfo * info) const
-{
-  TypeInfo * i = this->getMyInterfaceInfo();
-  while (i != 0) {
-    if (i == info) return true;
-    i = i->getBaseTypeInfo();
-  }
-  return false;
-}
-
 } // namespace
@@ -83,8 +83,11 @@ class TiInterface
     }
   }
 
-  /// Check if this interface is of the given type, or a derived type.
-  public: Bool isInterfaceDerivedFrom(TypeInfo *info) const;
+  /// Check, in constant time, if this interface is of the given type, or a derived type.
+  public: Bool isInterfaceDerivedFrom(TypeInfo *info) const
+  {
+    return this->getMyInterfaceInfo()->isDerivedFrom(info);
+  }
 
   /**
    * @brief A template equivalent to isInterfaceDerivedFrom.
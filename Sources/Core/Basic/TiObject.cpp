@@ -42,21 +42,17 @@ ObjectTypeInfo * TiObject::getTypeInfo()
 }
 
 
-/**
- * Check if this object is of the given type, or a derived type.
- *
- * @return Returns true if the given type info is for the class from which
- *         this object is instantiated, or for the class from which this
- *         object's class is derived, false otherwise.
- */
-Bool TiObject::isDerivedFrom(TypeInfo const *info) const
+void* TiObject::lookupInterface(TypeInfo *info)
 {
-  TypeInfo * i = this->getMyTypeInfo();
-  while (i != 0) {
-    if (i == info) return true;
-    i = i->getBaseTypeInfo();
+  auto typeInfo = this->getMyTypeInfo();
+  auto interface = this->_getInterface(info);
+  // A dynamic lookup during this call marks the type before we get here, so such results are never cached.
+  if (!typeInfo->hasDynamicInterfaces()) {
+    typeInfo->cacheInterface(
+      info, interface != 0, interface == 0 ? 0 : reinterpret_cast<Byte*>(interface) - reinterpret_cast<Byte*>(this)
+    );
   }
-  return false;
+  return interface;
 }
 
 } // namespace
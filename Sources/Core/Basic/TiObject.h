@@ -27,6 +27,16 @@ class TiInterface;
  */
 class TiObject : public std::enable_shared_from_this<TiObject>
 {
+  //============================================================================
+  // Constants
+
+  /**
+   * @brief Whether newSharedObject allocates objects of this type from a SlabPool.
+   * Derived types that are created in large numbers can set this to true.
+   */
+  public: static constexpr Bool SLAB_ALLOCATED = false;
+
+
   //============================================================================
   // Virtual Destructor
 
@@ -73,8 +83,14 @@ class TiObject : public std::enable_shared_from_this<TiObject>
   /// Get this type's info.
   public: static ObjectTypeInfo* getTypeInfo();
 
-  /// Check if this object is of the given type, or a derived type.
-  public: Bool isDerivedFrom(TypeInfo const *info) const;
+  /**
+   * @brief Check if this object is of the given type, or a derived type.
+   * This is done in constant time using the ancestry of the object's type.
+   */
+  public: Bool isDerivedFrom(TypeInfo const *info) const
+  {
+    return this->getMyTypeInfo()->isDerivedFrom(info);
+  }
 
   /**
    * @brief A template equivalent to isDerivedFrom.
@@ -110,7 +126,7 @@ class TiObject : public std::enable_shared_from_this<TiObject>
    */
   public: template<class T> T* getInterface()
   {
-    return reinterpret_cast<T*>(this->_getInterface(T::getTypeInfo()));
+    return reinterpret_cast<T*>(this->getInterface(T::getTypeInfo()));
   }
 
   /**
@@ -119,9 +135,25 @@ class TiObject : public std::enable_shared_from_this<TiObject>
    */
   public: template<class T> const T* getInterface() const
   {
-    return reinterpret_cast<const T*>(const_cast<TiObject*>(this)->_getInterface(T::getTypeInfo()));
+    return reinterpret_cast<const T*>(const_cast<TiObject*>(this)->getInterface(T::getTypeInfo()));
+  }
+
+  /**
+   * @brief Get a pointer to the interface with the given type info, if implemented.
+   * Results are cached per type, so only the first lookup of a given interface
+   * on a given type goes through _getInterface, unless the type looks up some
+   * of its interfaces dynamically.
+   */
+  public: void* getInterface(TypeInfo *info)
+  {
+    auto entry = this->getMyTypeInfo()->findCachedInterface(info);
+    if (entry != 0) return entry->implemented ? reinterpret_cast<Byte*>(this) + entry->offset : 0;
+    return this->lookupInterface(info);
   }
 
+  /// Look up an interface that isn't cached yet using _getInterface and cache the result.
+  private: void* lookupInterface(TypeInfo *info);
+
   /**
    * @brief Gets a shared pointer to this.
    * This function returns a shared pointer that shares ownership of this object
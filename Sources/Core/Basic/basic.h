@@ -644,6 +644,26 @@ void convertStr(Char const *input, int inputLength, WChar *output, int outputSiz
  */
 void convertStr(WChar const *input, int inputLength, Char *output, int outputSize, int &processedInputLength, int &resultedOutputLength);
 
+/**
+ * @brief Get the number of bytes needed to encode wide characters in utf8.
+ * @ingroup basic_functions
+ *
+ * @param input Input wide characters string.
+ * @param inputLength Length of input string.
+ */
+inline Word getUtf8Length(WChar const *input, Word inputLength)
+{
+  Word length = 0;
+  for (Word i = 0; i < inputLength; ++i) {
+    auto ch = static_cast<LongWord>(input[i]);
+    if (ch < 0x80) length += 1;
+    else if (ch < 0x800) length += 2;
+    else if (ch < 0x10000) length += 3;
+    else length += 4;
+  }
+  return length;
+}
+
 /**
  * @brief Get the wide character for a given UTF8 sequence.
  * @ingroup basic_functions
@@ -741,6 +761,7 @@ extern std::istream &inStream;
 
 #include "SortedIndex.h"
 #include "default_sorted_indices.h"
+#include "HashIndex.h"
 #include "SubsetIndex.h"
 
 #include "GlobalStorage.h"
@@ -755,6 +776,7 @@ extern std::istream &inStream;
 
 #include "SharedPtr.h"
 #include "WeakPtr.h"
+#include "SlabAllocator.h"
 
 #include "ti_object_factories.h"
 
@@ -57,6 +57,7 @@
                _INHERITANCE_INTERFACES_CONDITIONS1)(__VA_ARGS__)
 
 #define _OBJECT_INTERFACES_CONDITION(interface) \
+  this->getMyTypeInfo()->setDynamicInterfaces(); \
   if (this->interface->isInterfaceDerivedFrom(info)) return this->interface;
 #define _OBJECT_INTERFACES_CONDITIONS1(interface1) \
   _OBJECT_INTERFACES_CONDITION(interface1)
@@ -85,6 +86,7 @@
                _OBJECT_INTERFACES_CONDITIONS1)(__VA_ARGS__)
 
 #define OBJECT_INTERFACE_LIST(interfaceList) \
+  this->getMyTypeInfo()->setDynamicInterfaces(); \
   interfacePtr = this->interfaceList.get(info); \
   if (interfacePtr != 0) return interfacePtr;
 
@@ -119,7 +119,7 @@ template<class T> TiObjectFactory* getTiObjectFactory()
     },
     []()->SharedPtr<TiObject>
     {
-      return std::make_shared<T>();
+      return newSharedObject<T>();
     });
 }
 
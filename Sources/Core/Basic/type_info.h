@@ -28,6 +28,33 @@ namespace Core { namespace Basic
  */
 class TypeInfo
 {
+  //============================================================================
+  // Types
+
+  /**
+   * @brief The cached result of looking up an interface on objects of a type.
+   * @sa findCachedInterface()
+   */
+  public: struct InterfaceCacheEntry
+  {
+    /// Null for empty entries. Set last, after the rest of the entry is filled.
+    std::atomic<TypeInfo const*> interfaceInfo;
+    Bool implemented;
+    /// The offset of the interface from the TiObject part of the object.
+    PtrInt offset;
+  };
+
+
+  //============================================================================
+  // Constants
+
+  /// The number of entries in each type's interface cache. Must be a power of 2.
+  public: static constexpr Word INTERFACE_CACHE_SIZE = 32;
+
+  /// The maximum number of interface lookups cached per type, which keeps probe sequences short.
+  public: static constexpr Word INTERFACE_CACHE_MAX_COUNT = INTERFACE_CACHE_SIZE * 3 / 4;
+
+
   //============================================================================
   // Member Variables
 
@@ -70,6 +97,33 @@ class TypeInfo
   /// Pointer to the type info of the base type.
   private: TypeInfo * baseTypeInfo;
 
+  /**
+   * @brief The chain of base types, starting from the root type.
+   *
+   * The entry at index i is the ancestor at depth i, and the last entry is
+   * this type itself, which allows checking for ancestry in constant time.
+   * @sa isDerivedFrom()
+   */
+  private: std::vector<TypeInfo const*> ancestors;
+
+  /**
+   * @brief Cached results of looking up interfaces on objects of this type.
+   *
+   * An open addressing hash table keyed by the interface's type info. Entries
+   * are added under interfaceCacheMutex and are never modified afterwards, so
+   * readers don't need to lock.
+   */
+  private: std::atomic<InterfaceCacheEntry*> interfaceCache = { 0 };
+  private: Word interfaceCacheCount = 0;
+  private: std::mutex interfaceCacheMutex;
+
+  /**
+   * @brief Whether objects of this type look up some interfaces dynamically.
+   * Interface lookups on such types can differ between objects, so they are
+   * not cached.
+   */
+  private: std::atomic<Bool> dynamicInterfaces = { false };
+
 
   //============================================================================
   // Constructor
@@ -96,6 +150,8 @@ class TypeInfo
     baseTypeInfo(baseTypeInfo)
   {
     this->uniqueName = this->url + "#" + this->moduleName + "#" + this->typeNamespace + "." + this->typeName;
+    if (baseTypeInfo != 0) this->ancestors = baseTypeInfo->ancestors;
+    this->ancestors.push_back(this);
   }
 
 
@@ -158,6 +214,82 @@ class TypeInfo
     return this->baseTypeInfo;
   }
 
+  /// Get the number of base types above this type.
+  public: Word getDepth() const
+  {
+    return this->ancestors.size() - 1;
+  }
+
+  /// Check, in constant time, if this type is the given type or derived from it.
+  public: Bool isDerivedFrom(TypeInfo const *info) const
+  {
+    Word depth = info->ancestors.size() - 1;
+    return depth < this->ancestors.size() && this->ancestors[depth] == info;
+  }
+
+  /**
+   * @brief Find the cached result of looking up the given interface.
+   * @return The cache entry, or null if the lookup wasn't cached.
+   */
+  public: InterfaceCacheEntry const* findCachedInterface(TypeInfo const *interfaceInfo) const
+  {
+    auto entries = this->interfaceCache.load(std::memory_order_acquire);
+    if (entries == 0) return 0;
+    Word mask = INTERFACE_CACHE_SIZE - 1;
+    for (Word pos = TypeInfo::hashInterfaceInfo(interfaceInfo) & mask;; pos = (pos + 1) & mask) {
+      auto info = entries[pos].interfaceInfo.load(std::memory_order_acquire);
+      if (info == interfaceInfo) return entries + pos;
+      if (info == 0) return 0;
+    }
+  }
+
+  /**
+   * @brief Cache the result of looking up the given interface.
+   * Nothing is cached if the cache is full or if this type is marked as
+   * having dynamic interfaces.
+   */
+  public: void cacheInterface(TypeInfo const *interfaceInfo, Bool implemented, PtrInt offset)
+  {
+    if (this->hasDynamicInterfaces()) return;
+    std::lock_guard<std::mutex> lock(this->interfaceCacheMutex);
+    if (this->interfaceCacheCount >= INTERFACE_CACHE_MAX_COUNT) return;
+    auto entries = this->interfaceCache.load(std::memory_order_relaxed);
+    if (entries == 0) {
+      entries = new InterfaceCacheEntry[INTERFACE_CACHE_SIZE];
+      for (Word i = 0; i < INTERFACE_CACHE_SIZE; ++i) entries[i].interfaceInfo.store(0, std::memory_order_relaxed);
+      this->interfaceCache.store(entries, std::memory_order_release);
+    }
+    Word mask = INTERFACE_CACHE_SIZE - 1;
+    Word pos = TypeInfo::hashInterfaceInfo(interfaceInfo) & mask;
+    while (true) {
+      auto info = entries[pos].interfaceInfo.load(std::memory_order_relaxed);
+      if (info == interfaceInfo) return;
+      if (info == 0) break;
+      pos = (pos + 1) & mask;
+    }
+    entries[pos].implemented = implemented;
+    entries[pos].offset = offset;
+    entries[pos].interfaceInfo.store(interfaceInfo, std::memory_order_release);
+    ++this->interfaceCacheCount;
+  }
+
+  private: static Word hashInterfaceInfo(TypeInfo const *interfaceInfo)
+  {
+    auto value = reinterpret_cast<PtrWord>(interfaceInfo);
+    return (value >> 4) ^ (value >> 9);
+  }
+
+  /// Mark this type as looking up some interfaces dynamically, which disables interface caching.
+  public: void setDynamicInterfaces()
+  {
+    if (!this->hasDynamicInterfaces()) this->dynamicInterfaces.store(true, std::memory_order_relaxed);
+  }
+
+  public: Bool hasDynamicInterfaces() const
+  {
+    return this->dynamicInterfaces.load(std::memory_order_relaxed);
+  }
+
 }; // class
 
 
@@ -69,6 +69,7 @@ class Alias : public Node,
   public: void setReference(TioSharedPtr const &r)
   {
     UPDATE_OWNED_SHAREDPTR(this->reference, r);
+    advanceAstGeneration();
   }
   private: void setReference(TiObject *r)
   {
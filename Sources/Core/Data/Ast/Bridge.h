@@ -75,6 +75,7 @@ class Bridge : public Node,
   public: void setTarget(TioSharedPtr const &t)
   {
     UPDATE_OWNED_SHAREDPTR(this->target, t);
+    advanceAstGeneration();
   }
   private: void setTarget(TiObject *t)
   {
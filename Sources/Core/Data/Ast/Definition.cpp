@@ -15,6 +15,25 @@
 namespace Core::Data::Ast
 {
 
+//==============================================================================
+// Member Functions
+
+void Definition::setName(Char const *n)
+{
+  auto scope = ti_cast<Scope>(this->getOwner());
+  if (scope == 0) {
+    this->name = n;
+    this->nameAtom = 0;
+  } else if (this->name != n) {
+    auto oldNameAtom = this->getNameAtom();
+    this->name = n;
+    this->nameAtom = 0;
+    scope->onDefinitionRenamed(this, oldNameAtom);
+    advanceAstGeneration();
+  }
+}
+
+
 //==============================================================================
 // Printable Implementation
 
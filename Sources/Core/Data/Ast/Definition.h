@@ -33,6 +33,9 @@ class Definition : public Node,
   // Member Variables
 
   private: TiStr name;
+
+  /// The atom of the name, interned the first time it's requested.
+  private: mutable Char const *nameAtom = 0;
   private: TioSharedPtr target;
   private: TiBool toMerge;
   private: SharedPtr<List> modifiers;
@@ -74,13 +77,10 @@ class Definition : public Node,
   //============================================================================
   // Member Functions
 
-  public: void setName(Char const *n)
-  {
-    this->name = n;
-  }
+  public: void setName(Char const *n);
   public: void setName(TiStr const *n)
   {
-    this->name = n == 0 ? "" : n->get();
+    this->setName(n == 0 ? "" : n->get());
   }
 
   public: TiStr const& getName() const
@@ -88,9 +88,22 @@ class Definition : public Node,
     return this->name;
   }
 
+  /**
+   * @brief Get the atom of the name.
+   * Definitions with the same name will always have the same name atom, so
+   * names can be compared by pointer.
+   * @sa AtomTable
+   */
+  public: Char const* getNameAtom() const
+  {
+    if (this->nameAtom == 0) this->nameAtom = ATOM_TABLE->getAtom(this->name.get(), this->name.getStr().size());
+    return this->nameAtom;
+  }
+
   public: void setTarget(TioSharedPtr const &t)
   {
     UPDATE_OWNED_SHAREDPTR(this->target, t);
+    advanceAstGeneration();
   }
   private: void setTarget(TiObject *t)
   {
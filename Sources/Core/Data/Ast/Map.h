@@ -61,7 +61,7 @@ class Map : public NbMap,
   public: static SharedPtr<Map> create(
     std::initializer_list<Argument> const &attrs, std::initializer_list<Argument> const &elements, Bool useIndex
   ) {
-    return std::make_shared<Map>(attrs, elements, useIndex);
+    return newSharedObject<Map>(attrs, elements, useIndex);
   }
 
 }; // class
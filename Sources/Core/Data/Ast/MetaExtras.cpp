@@ -0,0 +1,71 @@
+/**
+ * @file Core/Data/Ast/MetaExtras.cpp
+ * Contains the implementation of class Core::Data::Ast::MetaExtras.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/alusus_license_1_0>.
+ */
+//==============================================================================
+
+#include "core.h"
+
+namespace Core::Data::Ast
+{
+
+//==============================================================================
+// Slot Registry
+
+/// The registered extra names, keyed by their atoms.
+struct MetaExtrasSlots
+{
+  std::unordered_map<Char const*, Word> slots;
+  std::vector<Char const*> names;
+  std::mutex mutex;
+};
+
+
+static MetaExtrasSlots* getMetaExtrasSlots()
+{
+  static MetaExtrasSlots *slots = 0;
+  if (slots == 0) {
+    slots = reinterpret_cast<MetaExtrasSlots*>(GLOBAL_STORAGE->getObject(S("Core::Data::Ast::MetaExtrasSlots")));
+    if (slots == 0) {
+      slots = new MetaExtrasSlots;
+      GLOBAL_STORAGE->setObject(S("Core::Data::Ast::MetaExtrasSlots"), reinterpret_cast<void*>(slots));
+    }
+  }
+  return slots;
+}
+
+
+//==============================================================================
+// Member Functions
+
+Word MetaExtras::getSlot(Char const *name)
+{
+  auto atom = ATOM_TABLE->getAtom(name);
+  auto registry = getMetaExtrasSlots();
+  std::lock_guard<std::mutex> lock(registry->mutex);
+  auto iter = registry->slots.find(atom);
+  if (iter != registry->slots.end()) return iter->second;
+  Word slot = registry->names.size();
+  registry->names.push_back(atom);
+  registry->slots[atom] = slot;
+  return slot;
+}
+
+
+Char const* MetaExtras::getSlotName(Word slot)
+{
+  auto registry = getMetaExtrasSlots();
+  std::lock_guard<std::mutex> lock(registry->mutex);
+  if (slot >= registry->names.size()) {
+    throw EXCEPTION(InvalidArgumentException, S("slot"), S("Slot is not registered."), slot);
+  }
+  return registry->names[slot];
+}
+
+} // namespace
@@ -0,0 +1,100 @@
+/**
+ * @file Core/Data/Ast/MetaExtras.h
+ * Contains the header of class Core::Data::Ast::MetaExtras.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/alusus_license_1_0>.
+ */
+//==============================================================================
+
+#ifndef CORE_DATA_AST_METAEXTRAS_H
+#define CORE_DATA_AST_METAEXTRAS_H
+
+namespace Core::Data::Ast
+{
+
+/**
+ * @brief The extra data attached to an AST node.
+ * @ingroup core_data
+ *
+ * Extras are keyed by slot ids rather than names. Each name is registered once
+ * using getSlot() to get a small integer slot id that's shared by all nodes,
+ * after which extras can be accessed by slot id without hashing or comparing
+ * any strings. Nodes usually hold only a few extras, so they are kept in a
+ * small list that's searched linearly.
+ * @sa MetaHaving
+ */
+class MetaExtras
+{
+  //============================================================================
+  // Types
+
+  private: struct Entry
+  {
+    Word slot;
+    TioSharedPtr obj;
+  };
+
+
+  //============================================================================
+  // Member Variables
+
+  private: std::vector<Entry> entries;
+
+
+  //============================================================================
+  // Member Functions
+
+  public: void set(Word slot, TioSharedPtr const &obj)
+  {
+    for (auto &entry : this->entries) {
+      if (entry.slot == slot) {
+        entry.obj = obj;
+        return;
+      }
+    }
+    this->entries.push_back({ slot, obj });
+  }
+
+  public: void remove(Word slot)
+  {
+    for (auto iter = this->entries.begin(); iter != this->entries.end(); ++iter) {
+      if (iter->slot == slot) {
+        this->entries.erase(iter);
+        return;
+      }
+    }
+  }
+
+  public: TioSharedPtr const& get(Word slot) const
+  {
+    for (auto const &entry : this->entries) {
+      if (entry.slot == slot) return entry.obj;
+    }
+    return TioSharedPtr::null;
+  }
+
+  public: Word getCount() const
+  {
+    return this->entries.size();
+  }
+
+  /**
+   * @brief Get the slot id of the given extra name, registering it if needed.
+   * Slot ids are shared by all libraries, so the same name always gets the
+   * same slot id. Callers on hot paths should get the slot id once and keep
+   * it rather than calling this function on every access.
+   */
+  public: static Word getSlot(Char const *name);
+
+  /// Get the name the given slot id was registered for.
+  public: static Char const* getSlotName(Word slot);
+
+}; // class
+
+} // namespace
+
+#endif
@@ -100,9 +100,33 @@ class MetaHaving : public TiInterface
     return sl;
   }
 
-  public: virtual void setExtra(Char const *name, TioSharedPtr const &obj) = 0;
-  public: virtual void removeExtra(Char const *name) = 0;
-  public: virtual TioSharedPtr const& getExtra(Char const *name) const = 0;
+  /**
+   * @brief Set extra data on this element by slot id.
+   * Slot ids are obtained from MetaExtras::getSlot(). Accessing extras by slot
+   * id doesn't involve any string hashing or comparison.
+   */
+  public: virtual void setExtra(Word slot, TioSharedPtr const &obj) = 0;
+  public: virtual void removeExtra(Word slot) = 0;
+  public: virtual TioSharedPtr const& getExtra(Word slot) const = 0;
+
+  /// @name Name Based Extras
+  /// These look up the slot id of the given name on each call.
+  /// @{
+
+  public: virtual void setExtra(Char const *name, TioSharedPtr const &obj)
+  {
+    this->setExtra(MetaExtras::getSlot(name), obj);
+  }
+  public: virtual void removeExtra(Char const *name)
+  {
+    this->removeExtra(MetaExtras::getSlot(name));
+  }
+  public: virtual TioSharedPtr const& getExtra(Char const *name) const
+  {
+    return this->getExtra(MetaExtras::getSlot(name));
+  }
+
+  /// @}
 
 }; // class
 
@@ -113,7 +137,7 @@ class MetaHaving : public TiInterface
 #define IMPLEMENT_METAHAVING(type) \
   private: Core::Basic::TiWord prodId = UNKNOWN_ID; \
   private: Core::Basic::SharedPtr<Core::Data::SourceLocation> sourceLocation; \
-  private: Core::Basic::SharedMap<Core::Basic::TiObject> extras; \
+  private: Core::Data::Ast::MetaExtras extras; \
   public: using MetaHaving::setProdId; \
   public: virtual void setProdId(Word id) \
   { \
@@ -136,20 +160,20 @@ class MetaHaving : public TiInterface
   { \
     return this->sourceLocation; \
   } \
-  public: virtual void setExtra(Char const *name, TioSharedPtr const &obj) \
+  public: using MetaHaving::setExtra; \
+  public: virtual void setExtra(Word slot, TioSharedPtr const &obj) \
   { \
-    this->extras.set(name, obj); \
+    this->extras.set(slot, obj); \
   } \
-  public: virtual void removeExtra(Char const *name) \
+  public: using MetaHaving::removeExtra; \
+  public: virtual void removeExtra(Word slot) \
   { \
-    auto index = this->extras.findIndex(name); \
-    if (index != -1) this->extras.remove(index); \
+    this->extras.remove(slot); \
   } \
-  public: virtual TioSharedPtr const& getExtra(Char const *name) const \
+  public: using MetaHaving::getExtra; \
+  public: virtual TioSharedPtr const& getExtra(Word slot) const \
   { \
-    auto index = this->extras.findIndex(name); \
-    if (index == -1) return TioSharedPtr::null; \
-    else return this->extras.get(index); \
+    return this->extras.get(slot); \
   }
 
 } // namespace
@@ -20,23 +20,94 @@ namespace Core::Data::Ast
 
 void Scope::onAdded(Int index)
 {
+  if (static_cast<Word>(index) < this->elementDefinitionEntries.size()) this->shiftDefinitionsIndex(index, 1);
+  this->elementDefinitionEntries.insert(this->elementDefinitionEntries.begin() + index, 0);
+  this->addToDefinitionsIndex(index);
   this->bridgesIndex.onAdded(index, ti_cast<Bridge>(this->getElement(index)) != 0);
+  advanceAstGeneration();
   List::onAdded(index);
 }
 
 void Scope::onUpdated(Int index)
 {
+  this->removeFromDefinitionsIndex(index);
+  this->addToDefinitionsIndex(index);
   this->bridgesIndex.onUpdated(index, ti_cast<Bridge>(this->getElement(index)) != 0);
+  advanceAstGeneration();
   List::onUpdated(index);
 }
 
 void Scope::onRemoved(Int index)
 {
+  this->removeFromDefinitionsIndex(index);
+  this->elementDefinitionEntries.erase(this->elementDefinitionEntries.begin() + index);
+  this->shiftDefinitionsIndex(index, -1);
   this->bridgesIndex.onRemoved(index);
+  advanceAstGeneration();
   List::onRemoved(index);
 }
 
 
+//==============================================================================
+// Definition Retrieval Functions
+
+Int Scope::findDefinitionIndex(Char const *nameAtom, Int startIndex) const
+{
+  auto iter = this->definitionsIndex.find(nameAtom);
+  if (iter == this->definitionsIndex.end()) return -1;
+  auto const &indices = iter->second;
+  auto pos = std::lower_bound(indices.begin(), indices.end(), startIndex);
+  return pos == indices.end() ? -1 : *pos;
+}
+
+
+void Scope::onDefinitionRenamed(Definition *def, Char const *oldNameAtom)
+{
+  auto iter = this->definitionsIndex.find(oldNameAtom);
+  if (iter == this->definitionsIndex.end()) return;
+  for (auto index : iter->second) {
+    if (this->getElement(index) == def) {
+      this->removeFromDefinitionsIndex(index);
+      this->addToDefinitionsIndex(index);
+      return;
+    }
+  }
+}
+
+
+void Scope::addToDefinitionsIndex(Int index)
+{
+  auto def = ti_cast<Definition>(this->getElement(index));
+  if (def == 0) return;
+  auto entry = &this->definitionsIndex[def->getNameAtom()];
+  entry->insert(std::lower_bound(entry->begin(), entry->end(), index), index);
+  this->elementDefinitionEntries[index] = entry;
+}
+
+
+void Scope::removeFromDefinitionsIndex(Int index)
+{
+  auto entry = this->elementDefinitionEntries[index];
+  if (entry == 0) return;
+  auto pos = std::lower_bound(entry->begin(), entry->end(), index);
+  ASSERT(pos != entry->end() && *pos == index);
+  entry->erase(pos);
+  this->elementDefinitionEntries[index] = 0;
+}
+
+
+void Scope::shiftDefinitionsIndex(Int index, Int offset)
+{
+  // Sorting is preserved since all indices at or after the given index are shifted.
+  for (auto &pair : this->definitionsIndex) {
+    auto &indices = pair.second;
+    for (auto pos = std::lower_bound(indices.begin(), indices.end(), index); pos != indices.end(); ++pos) {
+      *pos += offset;
+    }
+  }
+}
+
+
 //==============================================================================
 // Bridge Retrieval Functions
 
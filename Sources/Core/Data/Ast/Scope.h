@@ -30,6 +30,19 @@ class Scope : public List
 
   private: SubsetIndex bridgesIndex;
 
+  /**
+   * @brief The sorted indices of the definitions in this scope keyed by name.
+   * Used to look up definitions without scanning the whole scope.
+   */
+  private: std::unordered_map<Char const*, std::vector<Int>> definitionsIndex;
+
+  /**
+   * @brief The entry of definitionsIndex holding each element's index.
+   * Null for elements that aren't definitions. Entries of an unordered map
+   * are never moved, so these pointers remain valid as names are added.
+   */
+  private: std::vector<std::vector<Int>*> elementDefinitionEntries;
+
 
   //============================================================================
   // Implementations
@@ -61,6 +74,33 @@ class Scope : public List
 
   /// @}
 
+  /// @name Definition Retrieval Functions
+  /// @{
+
+  /**
+   * @brief Find the index of the first definition with the given name.
+   * The search starts at the given element index, so all the definitions with
+   * a given name can be visited in order by repeatedly searching from the
+   * index following the last match.
+   * @param nameAtom The atom of the name within the atom table.
+   * @return The element index of the found definition, or -1 if none is found.
+   */
+  public: Int findDefinitionIndex(Char const *nameAtom, Int startIndex = 0) const;
+
+  /**
+   * @brief Update the index after a definition within this scope is renamed.
+   * Called by Definition::setName for definitions owned by this scope.
+   */
+  public: void onDefinitionRenamed(Definition *def, Char const *oldNameAtom);
+
+  private: void addToDefinitionsIndex(Int index);
+
+  private: void removeFromDefinitionsIndex(Int index);
+
+  private: void shiftDefinitionsIndex(Int index, Int offset);
+
+  /// @}
+
   /// @name Bridge Retrieval Functions
   /// @{
 
@@ -39,6 +39,9 @@ class Text : public Node, public Binding, public MetaHaving, public Printable
    */
   private: TiStr value;
 
+  /// The atom of the value, interned the first time it's requested.
+  private: mutable Char const *atom = 0;
+
 
   //============================================================================
   // Implementations
@@ -66,14 +69,17 @@ class Text : public Node, public Binding, public MetaHaving, public Printable
   public: void setValue(Char const *v)
   {
     this->value = v;
+    this->atom = 0;
   }
   public: void setValue(Char const *v, Int s)
   {
     this->value.set(v, s);
+    this->atom = 0;
   }
   public: void setValue(TiStr const *v)
   {
     this->value = v == 0 ? "" : v->get();
+    this->atom = 0;
   }
 
   public: TiStr const& getValue() const
@@ -81,6 +87,20 @@ class Text : public Node, public Binding, public MetaHaving, public Printable
     return this->value;
   }
 
+  /**
+   * @brief Get the atom of the value.
+   * Texts with the same value will always have the same atom, so values can
+   * be compared by pointer.
+   * @sa AtomTable
+   */
+  public: Char const* getAtom() const
+  {
+    if (this->atom == 0) {
+      this->atom = ATOM_TABLE->getAtom(this->value.get(), this->value.getStr().size());
+    }
+    return this->atom;
+  }
+
 
   //============================================================================
   // Printable Implementation
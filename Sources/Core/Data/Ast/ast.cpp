@@ -15,6 +15,13 @@
 namespace Core::Data::Ast
 {
 
+/// Source location stacks created for the clones, keyed by the original source location.
+typedef std::unordered_map<SourceLocation*, SharedPtr<SourceLocation>> ClonedSourceLocations;
+
+static SharedPtr<SourceLocation> stackSourceLocation(SourceLocation *sl, SourceLocation *currentSl);
+static TioSharedPtr cloneNode(TiObject *obj, SourceLocation *sl, ClonedSourceLocations *clonedSls);
+
+
 //============================================================================
 // Global Functions
 
@@ -35,43 +42,63 @@ void addSourceLocation(TiObject *obj, SourceLocation *sl)
   if (currentSl == 0) {
     metadata->setSourceLocation(sl);
   } else {
-    auto newSl = std::make_shared<SourceLocationStack>();
-    newSl->push(sl);
-    newSl->push(currentSl.get());
-    metadata->setSourceLocation(newSl);
+    metadata->setSourceLocation(stackSourceLocation(sl, currentSl.get()));
   }
 }
 
 
+/// Create a source location stack with the given location pushed on top of the current one.
+static SharedPtr<SourceLocation> stackSourceLocation(SourceLocation *sl, SourceLocation *currentSl)
+{
+  auto newSl = std::make_shared<SourceLocationStack>();
+  newSl->reserve(getSourceLocationRecordCount(sl) + getSourceLocationRecordCount(currentSl));
+  newSl->push(sl);
+  newSl->push(currentSl);
+  return newSl;
+}
+
+
 Bool mergeDefinition(Definition *def, DynamicContaining<TiObject> *target, Notices::Store *noticeStore)
 {
   VALIDATE_NOT_NULL(def, target, noticeStore);
-  for (Int i = 0; i < target->getElementCount(); ++i) {
-    auto targetDef = ti_cast<Definition>(target->getElement(i));
-    if (targetDef != 0 && targetDef->getName() == def->getName()) {
-      auto targetObj = targetDef->getTarget().ti_cast<Mergeable>();
-      if (targetObj == 0) {
-        noticeStore->add(
-          std::make_shared<Core::Notices::IncompatibleDefMergeNotice>(findSourceLocation(def))
-        );
-        return false;
+  // Find the definition to merge into. Scopes index their definitions by name so there is no need to scan them.
+  Definition *targetDef = 0;
+  auto scope = ti_cast<Scope>(target);
+  if (scope != 0) {
+    Int index = scope->findDefinitionIndex(def->getNameAtom());
+    if (index != -1) targetDef = static_cast<Definition*>(scope->getElement(index));
+  } else {
+    for (Int i = 0; i < target->getElementCount(); ++i) {
+      auto d = ti_cast<Definition>(target->getElement(i));
+      if (d != 0 && d->getNameAtom() == def->getNameAtom()) {
+        targetDef = d;
+        break;
       }
-      // Merge the definition modifiers.
-      if (def->getModifiers() != 0) {
-        if (targetDef->getModifiers() == 0) {
-          targetDef->setModifiers(def->getModifiers());
-        } else {
-          for (Int i = 0; i < def->getModifiers()->getCount(); ++i) {
-            targetDef->getModifiers()->add(def->getModifiers()->get(i));
-          }
-        }
+    }
+  }
+  if (targetDef == 0) {
+    target->addElement(def);
+    return true;
+  }
+  auto targetObj = targetDef->getTarget().ti_cast<Mergeable>();
+  if (targetObj == 0) {
+    noticeStore->add(
+      std::make_shared<Core::Notices::IncompatibleDefMergeNotice>(findSourceLocation(def))
+    );
+    return false;
+  }
+  // Merge the definition modifiers.
+  if (def->getModifiers() != 0) {
+    if (targetDef->getModifiers() == 0) {
+      targetDef->setModifiers(def->getModifiers());
+    } else {
+      for (Int i = 0; i < def->getModifiers()->getCount(); ++i) {
+        targetDef->getModifiers()->add(def->getModifiers()->get(i));
       }
-      // Merge the target itself.
-      return targetObj->merge(def->getTarget().get(), noticeStore);
     }
   }
-  target->addElement(def);
-  return true;
+  // Merge the target itself.
+  return targetObj->merge(def->getTarget().get(), noticeStore);
 }
 
 
@@ -123,9 +150,51 @@ void translateModifier(Data::Grammar::SymbolDefinition *symbolDef, TiObject *mod
 }
 
 
+/// The counter is kept in the global storage so that all libraries share the same generation.
+static Word* getAstGenerationCounter()
+{
+  static Word *astGeneration = 0;
+  if (astGeneration == 0) {
+    astGeneration = reinterpret_cast<Word*>(GLOBAL_STORAGE->getObject(S("Core::Data::Ast::astGeneration")));
+    if (astGeneration == 0) {
+      astGeneration = new Word(0);
+      GLOBAL_STORAGE->setObject(S("Core::Data::Ast::astGeneration"), reinterpret_cast<void*>(astGeneration));
+    }
+  }
+  return astGeneration;
+}
+
+
+Word getAstGeneration()
+{
+  return *getAstGenerationCounter();
+}
+
+
+void advanceAstGeneration()
+{
+  ++*getAstGenerationCounter();
+}
+
+
+/**
+ * The clones of all nodes that were at the same source location share a
+ * single source location stack, which is possible since attached source
+ * locations are never modified.
+ */
 TioSharedPtr _clone(TioSharedPtr const &obj, SourceLocation *sl)
 {
   if (obj.ti_cast_get<Node>() == 0) return obj;
+  if (sl == 0) return cloneNode(obj.get(), 0, 0);
+  ClonedSourceLocations clonedSourceLocations;
+  return cloneNode(obj.get(), sl, &clonedSourceLocations);
+}
+
+
+/// Children are passed as plain pointers since the shared pointers of nodes are only needed for non-node children.
+static TioSharedPtr cloneNode(TiObject *obj, SourceLocation *sl, ClonedSourceLocations *clonedSls)
+{
+  if (ti_cast<Node>(obj) == 0) return getSharedPtr(obj);
 
   auto factory = obj->getMyTypeInfo()->getFactory();
   if (!factory) {
@@ -133,59 +202,69 @@ TioSharedPtr _clone(TioSharedPtr const &obj, SourceLocation *sl)
   }
   auto clone = factory->createShared();
 
-  auto bindings = obj.ti_cast_get<Binding>();
+  auto bindings = ti_cast<Binding>(obj);
   auto cloneBindings = clone.ti_cast_get<Binding>();
   if (cloneBindings != 0) {
     for (Int i = 0; i < bindings->getMemberCount(); ++i) {
       if (bindings->getMemberHoldMode(i) == HoldMode::SHARED_REF) {
-        auto childMember = getSharedPtr(bindings->getMember(i));
-        cloneBindings->setMember(i, _clone(childMember, sl).get());
+        cloneBindings->setMember(i, cloneNode(bindings->getMember(i), sl, clonedSls).get());
       } else {
         cloneBindings->setMember(i, bindings->getMember(i));
       }
     }
   }
 
-  auto dynMapContainer = obj.ti_cast_get<DynamicMapContaining<TiObject>>();
+  auto dynMapContainer = ti_cast<DynamicMapContaining<TiObject>>(obj);
   auto cloneDynMapContainer = clone.ti_cast_get<DynamicMapContaining<TiObject>>();
   if (cloneDynMapContainer != 0) {
     for (Int i = 0; i < dynMapContainer->getElementCount(); ++i) {
       if (dynMapContainer->getElementHoldMode(i) == HoldMode::SHARED_REF) {
-        auto childElement = getSharedPtr(dynMapContainer->getElement(i));
-        cloneDynMapContainer->addElement(dynMapContainer->getElementKey(i).c_str(), _clone(childElement, sl).get());
+        cloneDynMapContainer->addElement(
+          dynMapContainer->getElementKey(i).c_str(), cloneNode(dynMapContainer->getElement(i), sl, clonedSls).get()
+        );
       } else {
         cloneDynMapContainer->addElement(dynMapContainer->getElementKey(i).c_str(), dynMapContainer->getElement(i));
       }
     }
   }
 
-  auto dynContainer = obj.ti_cast_get<DynamicContaining<TiObject>>();
+  auto dynContainer = ti_cast<DynamicContaining<TiObject>>(obj);
   auto cloneDynContainer = clone.ti_cast_get<DynamicContaining<TiObject>>();
   if (cloneDynContainer != 0) {
     for (Int i = 0; i < dynContainer->getElementCount(); ++i) {
       if (dynContainer->getElementHoldMode(i) == HoldMode::SHARED_REF) {
-        auto childElement = getSharedPtr(dynContainer->getElement(i));
-        cloneDynContainer->addElement(_clone(childElement, sl).get());
+        cloneDynContainer->addElement(cloneNode(dynContainer->getElement(i), sl, clonedSls).get());
       } else {
         cloneDynContainer->addElement(dynContainer->getElement(i));
       }
     }
   }
 
-  auto container = obj.ti_cast_get<Containing<TiObject>>();
+  auto container = ti_cast<Containing<TiObject>>(obj);
   auto cloneContainer = clone.ti_cast_get<Containing<TiObject>>();
   if (cloneDynContainer == 0 && cloneDynMapContainer == 0 && cloneContainer != 0) {
     for (Int i = 0; i < container->getElementCount(); ++i) {
       if (container->getElementHoldMode(i) == HoldMode::SHARED_REF) {
-        auto childElement = getSharedPtr(container->getElement(i));
-        cloneContainer->setElement(i, _clone(childElement, sl).get());
+        cloneContainer->setElement(i, cloneNode(container->getElement(i), sl, clonedSls).get());
       } else {
         cloneContainer->setElement(i, container->getElement(i));
       }
     }
   }
 
-  if (sl != 0) addSourceLocation(clone.get(), sl);
+  if (sl != 0) {
+    auto metadata = clone.ti_cast_get<MetaHaving>();
+    if (metadata != 0) {
+      auto currentSl = metadata->findSourceLocation().get();
+      if (currentSl == 0) {
+        metadata->setSourceLocation(sl);
+      } else {
+        auto &clonedSl = (*clonedSls)[currentSl];
+        if (clonedSl == 0) clonedSl = stackSourceLocation(sl, currentSl);
+        metadata->setSourceLocation(clonedSl);
+      }
+    }
+  }
 
   return clone;
 }
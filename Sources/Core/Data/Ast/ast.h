@@ -90,6 +90,16 @@ Bool addPossiblyMergeableElements(
 );
 void translateModifier(Data::Grammar::SymbolDefinition *symbolDef, TiObject *modifier);
 
+/**
+ * @brief Get the current AST generation.
+ * The generation is advanced whenever the AST is modified in a way that can
+ * change the result of resolving references, like adding definitions to a
+ * scope, so results cached at a given generation remain valid for as long as
+ * the generation doesn't change.
+ */
+Word getAstGeneration();
+void advanceAstGeneration();
+
 TioSharedPtr _clone(TioSharedPtr const &obj, SourceLocation *sl);
 template <class T> SharedPtr<T> clone(SharedPtr<T> const &obj, SourceLocation *sl = 0)
 {
@@ -98,6 +108,7 @@ template <class T> SharedPtr<T> clone(SharedPtr<T> const &obj, SourceLocation *s
 
 } // namespace
 
+#include "MetaExtras.h"
 #include "MetaHaving.h"
 #include "Mergeable.h"
 
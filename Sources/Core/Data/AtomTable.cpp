@@ -0,0 +1,68 @@
+/**
+ * @file Core/Data/AtomTable.cpp
+ * Contains the implementation of class Core::Data::AtomTable.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/alusus_license_1_0>.
+ */
+//==============================================================================
+
+#include "core.h"
+
+namespace Core { namespace Data
+{
+
+//==============================================================================
+// Member Functions
+
+Char const* AtomTable::getAtom(Char const *str, Word length)
+{
+  std::string_view view(str, length);
+  {
+    std::shared_lock<std::shared_mutex> lock(this->mutex);
+    auto i = this->atoms.find(view);
+    if (i != this->atoms.end()) return i->data();
+  }
+  std::unique_lock<std::shared_mutex> lock(this->mutex);
+  // Another thread could have added the string while the lock was released.
+  auto i = this->atoms.find(view);
+  if (i != this->atoms.end()) return i->data();
+  this->strings.emplace_back(str, length);
+  auto const &stored = this->strings.back();
+  this->atoms.insert(std::string_view(stored.c_str(), stored.size()));
+  return stored.c_str();
+}
+
+
+Char const* AtomTable::findAtom(Char const *str, Word length) const
+{
+  std::shared_lock<std::shared_mutex> lock(this->mutex);
+  auto i = this->atoms.find(std::string_view(str, length));
+  return i == this->atoms.end() ? 0 : i->data();
+}
+
+
+Word AtomTable::getCount() const
+{
+  std::shared_lock<std::shared_mutex> lock(this->mutex);
+  return this->strings.size();
+}
+
+
+AtomTable* AtomTable::getSingleton()
+{
+  static AtomTable *atomTable = 0;
+  if (atomTable == 0) {
+    atomTable = reinterpret_cast<AtomTable*>(GLOBAL_STORAGE->getObject(S("Core::Data::AtomTable")));
+    if (atomTable == 0) {
+      atomTable = new AtomTable;
+      GLOBAL_STORAGE->setObject(S("Core::Data::AtomTable"), reinterpret_cast<void*>(atomTable));
+    }
+  }
+  return atomTable;
+}
+
+} } // namespace
@@ -0,0 +1,86 @@
+/**
+ * @file Core/Data/AtomTable.h
+ * Contains the header of class Core::Data::AtomTable.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/alusus_license_1_0>.
+ */
+//==============================================================================
+
+#ifndef CORE_DATA_ATOMTABLE_H
+#define CORE_DATA_ATOMTABLE_H
+
+namespace Core { namespace Data
+{
+
+/**
+ * @brief A table of interned strings.
+ * @ingroup core_data
+ *
+ * Each distinct string is stored once in this table and is represented by a
+ * pointer to its stored, null terminated, characters, called its atom. Two
+ * strings are equal if and only if their atoms are the same pointer, so atoms
+ * can be compared and hashed without looking at their characters. Strings are
+ * never removed from the table and their characters never move, so atoms stay
+ * valid for the lifetime of the process.
+ *
+ * This singleton class can be used from multiple threads at the same time.
+ */
+class AtomTable
+{
+  //============================================================================
+  // Member Variables
+
+  /// The stored strings. A deque never moves its elements as more are added.
+  private: std::deque<Str> strings;
+
+  /// Views on the stored strings, used for searching.
+  private: std::unordered_set<std::string_view> atoms;
+
+  private: mutable std::shared_mutex mutex;
+
+
+  //============================================================================
+  // Constructor
+
+  /// Prevent the singleton class from being inistantiated.
+  private: AtomTable()
+  {
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  /// Get the atom of the given string, adding the string to the table if needed.
+  public: Char const* getAtom(Char const *str)
+  {
+    return this->getAtom(str, strlen(str));
+  }
+
+  /**
+   * @brief Get the atom of the given string, adding the string to the table if needed.
+   * @param str A pointer to the characters of the string, which doesn't need
+   *            to be null terminated.
+   * @param length The number of characters in the string.
+   */
+  public: Char const* getAtom(Char const *str, Word length);
+
+  /// Get the atom of the given string if it was already added to the table, or null otherwise.
+  public: Char const* findAtom(Char const *str, Word length) const;
+
+  public: Word getCount() const;
+
+  /// Get the singleton object.
+  public: static AtomTable* getSingleton();
+
+}; // class
+
+} } // namespace
+
+#define ATOM_TABLE Core::Data::AtomTable::getSingleton()
+
+#endif
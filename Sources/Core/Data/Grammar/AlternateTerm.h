@@ -37,18 +37,11 @@ class AlternateTerm : public ListTerm
   OBJECT_FACTORY(AlternateTerm);
 
 
-  //============================================================================
-  // Types
-
-  public: typedef std::unordered_map<Str, Int, std::hash<std::string>> TextBasedDecisionCache;
-  public: typedef std::unordered_map<Word, Int> IdBasedDecisionCache;
-
-
   //============================================================================
   // Member Variables
 
-  private: TextBasedDecisionCache textBasedDecisionCache;
-  private: IdBasedDecisionCache idBasedDecisionCache;
+  /// The routes previously taken at this term, keyed by token.
+  private: DecisionTable decisionTable;
 
 
   //============================================================================
@@ -66,14 +59,9 @@ class AlternateTerm : public ListTerm
   //============================================================================
   // Member Functions
 
-  public: TextBasedDecisionCache* getInnerTextBasedDecisionCache()
-  {
-    return &this->textBasedDecisionCache;
-  }
-
-  public: IdBasedDecisionCache* getInnerIdBasedDecisionCache()
+  public: DecisionTable* getDecisionTable()
   {
-    return &this->idBasedDecisionCache;
+    return &this->decisionTable;
   }
 
 
@@ -83,8 +71,8 @@ class AlternateTerm : public ListTerm
   /// @sa CacheHaving::clearCache()
   public: virtual void clearCache()
   {
-    this->textBasedDecisionCache.clear();
-    this->idBasedDecisionCache.clear();
+    ListTerm::clearCache();
+    this->decisionTable.clear();
   }
 
 }; // class
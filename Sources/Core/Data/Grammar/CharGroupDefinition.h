@@ -24,13 +24,13 @@ namespace Core::Data::Grammar
  * definition includes the CharGroupUnit tree and the identifier of the char
  * group.
  */
-class CharGroupDefinition : public Node, public Binding, public IdHaving
+class CharGroupDefinition : public Node, public Binding, public IdHaving, public CacheHaving
 {
   //============================================================================
   // Type Info
 
   TYPE_INFO(CharGroupDefinition, Node, "Core.Data.Grammar", "Core", "alusus.org");
-  IMPLEMENT_INTERFACES(Node, Binding, IdHaving);
+  IMPLEMENT_INTERFACES(Node, Binding, IdHaving, CacheHaving);
 
 
   //============================================================================
@@ -43,6 +43,14 @@ class CharGroupDefinition : public Node, public Binding, public IdHaving
    */
   private: SharedPtr<CharGroupUnit> charGroupUnit;
 
+  /**
+   * @brief The compiled form of the char group.
+   *
+   * Lazily built from the char group unit tree the first time it's needed.
+   * @sa getCompiledCharGroup()
+   */
+  private: SharedPtr<CompiledCharGroup> compiledCharGroup;
+
 
   //============================================================================
   // Implementations
@@ -98,6 +106,7 @@ class CharGroupDefinition : public Node, public Binding, public IdHaving
     }
     this->charGroupUnit = u;
     this->charGroupUnit->setOwner(this);
+    this->compiledCharGroup.reset();
   }
 
   /// Get the formula head object.
@@ -106,6 +115,34 @@ class CharGroupDefinition : public Node, public Binding, public IdHaving
     return this->charGroupUnit;
   }
 
+  /**
+   * @brief Get the compiled form of the char group.
+   *
+   * The compiled form is built the first time this function is called and is
+   * kept until the cache is cleared. Matching characters against the compiled
+   * form avoids walking the char group unit tree for each character.
+   */
+  public: SharedPtr<CompiledCharGroup> const& getCompiledCharGroup()
+  {
+    if (this->compiledCharGroup == 0) {
+      if (this->charGroupUnit == 0) {
+        throw EXCEPTION(GenericException, S("Char group unit is not set yet."));
+      }
+      this->compiledCharGroup = std::make_shared<CompiledCharGroup>(this->charGroupUnit.get());
+    }
+    return this->compiledCharGroup;
+  }
+
+
+  //============================================================================
+  // CacheHaving Implementation
+
+  /// @sa CacheHaving::clearCache()
+  public: virtual void clearCache()
+  {
+    this->compiledCharGroup.reset();
+  }
+
 };
 
 } // namespace
@@ -0,0 +1,118 @@
+/**
+ * @file Core/Data/Grammar/CompiledCharGroup.cpp
+ * Contains the implementation of class Core::Data::Grammar::CompiledCharGroup.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/alusus_license_1_0>.
+ */
+//==============================================================================
+
+#include <algorithm>
+#include "core.h"
+
+namespace Core::Data::Grammar
+{
+
+//==============================================================================
+// Local Definitions
+
+namespace
+{
+
+/// Ranges are collected as LongInt to avoid overflows at the edges of WChar.
+typedef std::vector<std::pair<LongInt, LongInt>> CharRanges;
+
+
+void normalizeCharRanges(CharRanges &ranges)
+{
+  if (ranges.size() < 2) return;
+  std::sort(ranges.begin(), ranges.end());
+  Word count = 1;
+  for (Word i = 1; i < ranges.size(); ++i) {
+    if (ranges[i].first <= ranges[count - 1].second + 1) {
+      if (ranges[i].second > ranges[count - 1].second) ranges[count - 1].second = ranges[i].second;
+    } else {
+      ranges[count++] = ranges[i];
+    }
+  }
+  ranges.resize(count);
+}
+
+
+/// Convert a char group tree into a sorted list of non overlapping ranges.
+void collectCharGroupRanges(CharGroupUnit *unit, CharRanges &ranges)
+{
+  ASSERT(unit);
+
+  ranges.clear();
+  if (unit->isA<SequenceCharGroupUnit>()) {
+    SequenceCharGroupUnit *u = static_cast<SequenceCharGroupUnit*>(unit);
+    if (u->getStartCode() == 0 && u->getEndCode() == 0) {
+      throw EXCEPTION(GenericException, S("Sequence char group unit is not configured yet."));
+    }
+    if (u->getStartCode() <= u->getEndCode()) ranges.push_back({ u->getStartCode(), u->getEndCode() });
+  } else if (unit->isA<RandomCharGroupUnit>()) {
+    RandomCharGroupUnit *u = static_cast<RandomCharGroupUnit*>(unit);
+    if (u->getCharList() == 0) {
+      throw EXCEPTION(GenericException, S("Random char group unit is not configured yet."));
+    }
+    for (Int i = 0; i < u->getCharListSize(); ++i) {
+      ranges.push_back({ u->getCharList()[i], u->getCharList()[i] });
+    }
+    normalizeCharRanges(ranges);
+  } else if (unit->isA<UnionCharGroupUnit>()) {
+    UnionCharGroupUnit *u = static_cast<UnionCharGroupUnit*>(unit);
+    if (u->getCharGroupUnits()->size() == 0) {
+      throw EXCEPTION(GenericException, S("Union char group unit is not configured yet."));
+    }
+    CharRanges childRanges;
+    for (Int i = 0; i < static_cast<Int>(u->getCharGroupUnits()->size()); ++i) {
+      collectCharGroupRanges(u->getCharGroupUnits()->at(i).get(), childRanges);
+      ranges.insert(ranges.end(), childRanges.begin(), childRanges.end());
+    }
+    normalizeCharRanges(ranges);
+  } else if (unit->isA<InvertCharGroupUnit>()) {
+    InvertCharGroupUnit *u = static_cast<InvertCharGroupUnit*>(unit);
+    if (u->getChildCharGroupUnit() == 0) {
+      throw EXCEPTION(GenericException, S("Invert char group unit is not configured yet."));
+    }
+    CharRanges childRanges;
+    collectCharGroupRanges(u->getChildCharGroupUnit().get(), childRanges);
+    LongInt next = WCHAR_MIN;
+    for (auto const &range : childRanges) {
+      if (range.first > next) ranges.push_back({ next, range.first - 1 });
+      next = range.second + 1;
+    }
+    if (next <= WCHAR_MAX) ranges.push_back({ next, WCHAR_MAX });
+  } else {
+    throw EXCEPTION(GenericException, S("Invalid char group type."));
+  }
+}
+
+} // namespace
+
+
+//==============================================================================
+// Constructor
+
+CompiledCharGroup::CompiledCharGroup(CharGroupUnit *unit)
+{
+  CharRanges charRanges;
+  collectCharGroupRanges(unit, charRanges);
+
+  this->ranges.reserve(charRanges.size());
+  for (auto const &range : charRanges) {
+    this->ranges.push_back({ static_cast<WChar>(range.first), static_cast<WChar>(range.second) });
+    // Fill the ASCII bitmap.
+    LongInt asciiStart = std::max(range.first, 0LL);
+    LongInt asciiEnd = std::min(range.second, 127LL);
+    for (LongInt ch = asciiStart; ch <= asciiEnd; ++ch) {
+      this->asciiBits[ch >> 6] |= 1ULL << (ch & 63);
+    }
+  }
+}
+
+} // namespace
@@ -0,0 +1,92 @@
+/**
+ * @file Core/Data/Grammar/CompiledCharGroup.h
+ * Contains the header of class Core::Data::Grammar::CompiledCharGroup.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/alusus_license_1_0>.
+ */
+//==============================================================================
+
+#ifndef CORE_DATA_GRAMMAR_COMPILEDCHARGROUP_H
+#define CORE_DATA_GRAMMAR_COMPILEDCHARGROUP_H
+
+namespace Core::Data::Grammar
+{
+
+/**
+ * @brief A flattened form of a char group unit tree.
+ * @ingroup data_char_group_units
+ *
+ * This class holds the set of characters matched by a tree of CharGroupUnit
+ * objects in a form that can be queried without walking the tree. ASCII
+ * characters are looked up in a 128-bit bitmap while other characters are
+ * looked up using a binary search over a sorted list of non overlapping
+ * ranges.
+ */
+class CompiledCharGroup
+{
+  //============================================================================
+  // Types
+
+  /// An inclusive range of characters.
+  public: struct Range
+  {
+    WChar start;
+    WChar end;
+  };
+
+
+  //============================================================================
+  // Member Variables
+
+  /// Membership bits of ASCII characters.
+  private: LongWord asciiBits[2] = { 0, 0 };
+
+  /// All matched characters as sorted, non overlapping, and non adjacent ranges.
+  private: std::vector<Range> ranges;
+
+
+  //============================================================================
+  // Constructor
+
+  /**
+   * @brief Compile the given char group unit tree.
+   *
+   * Throws the same exceptions matchCharGroup() throws if the tree is not
+   * fully configured yet.
+   */
+  public: CompiledCharGroup(CharGroupUnit *unit);
+
+
+  //============================================================================
+  // Member Functions
+
+  /// Check whether the given character belongs to this char group.
+  public: Bool match(WChar ch) const
+  {
+    if (ch >= 0 && ch < 128) return (this->asciiBits[ch >> 6] >> (ch & 63)) & 1;
+    Int low = 0;
+    Int high = static_cast<Int>(this->ranges.size()) - 1;
+    while (low <= high) {
+      Int mid = (low + high) / 2;
+      if (ch < this->ranges[mid].start) high = mid - 1;
+      else if (ch > this->ranges[mid].end) low = mid + 1;
+      else return true;
+    }
+    return false;
+  }
+
+  /// Get the sorted list of character ranges matched by this char group.
+  public: std::vector<Range> const& getRanges() const
+  {
+    return this->ranges;
+  }
+
+}; // class
+
+} // namespace
+
+#endif
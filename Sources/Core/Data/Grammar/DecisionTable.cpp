@@ -0,0 +1,54 @@
+/**
+ * @file Core/Data/Grammar/DecisionTable.cpp
+ * Contains the implementation of class Core::Data::Grammar::DecisionTable.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/alusus_license_1_0>.
+ */
+//==============================================================================
+
+#include "core.h"
+
+namespace Core::Data::Grammar
+{
+
+//==============================================================================
+// Member Functions
+
+void DecisionTable::set(Word key, Int route)
+{
+  ASSERT(key != EMPTY_KEY);
+
+  // Keep the load factor at or below one half.
+  if ((this->count + 1) * 2 > this->entries.size()) this->grow();
+
+  Word mask = this->entries.size() - 1;
+  for (Word i = DecisionTable::hash(key) & mask;; i = (i + 1) & mask) {
+    if (this->entries[i].key == key) {
+      this->entries[i].route = route;
+      return;
+    } else if (this->entries[i].key == EMPTY_KEY) {
+      this->entries[i].key = key;
+      this->entries[i].route = route;
+      ++this->count;
+      return;
+    }
+  }
+}
+
+
+void DecisionTable::grow()
+{
+  std::vector<Entry> oldEntries;
+  oldEntries.swap(this->entries);
+  this->entries.resize(oldEntries.size() == 0 ? 16 : oldEntries.size() * 2, { EMPTY_KEY, 0 });
+  this->count = 0;
+  for (auto const &entry : oldEntries) {
+    if (entry.key != EMPTY_KEY) this->set(entry.key, entry.route);
+  }
+}
+
+} // namespace
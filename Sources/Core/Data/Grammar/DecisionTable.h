@@ -0,0 +1,112 @@
+/**
+ * @file Core/Data/Grammar/DecisionTable.h
+ * Contains the header of class Core::Data::Grammar::DecisionTable.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/alusus_license_1_0>.
+ */
+//==============================================================================
+
+#ifndef CORE_DATA_GRAMMAR_DECISIONTABLE_H
+#define CORE_DATA_GRAMMAR_DECISIONTABLE_H
+
+namespace Core::Data::Grammar
+{
+
+/**
+ * @brief A cache of the parser's routing decisions at a term.
+ * @ingroup core_data_grammar
+ *
+ * This class maps a token key to the route the parser previously decided to
+ * take at a term when it received a token with that key. Non-keyword tokens
+ * are keyed by their id while keywords are keyed by the interned id of their
+ * text, flagged with KEYWORD_KEY_FLAG so the two never collide. Entries are
+ * kept in an open addressing table with linear probing, which avoids the
+ * hashing of token text and the node allocations of a standard map.
+ */
+class DecisionTable
+{
+  //============================================================================
+  // Types
+
+  private: struct Entry
+  {
+    Word key;
+    Int route;
+  };
+
+
+  //============================================================================
+  // Constants
+
+  /// The flag added to keys generated from keyword text ids.
+  public: static constexpr Word KEYWORD_KEY_FLAG = static_cast<Word>(1) << (sizeof(Word) * 8 - 1);
+
+  /// The key used to mark empty slots.
+  private: static constexpr Word EMPTY_KEY = ~static_cast<Word>(0);
+
+
+  //============================================================================
+  // Member Variables
+
+  /// The slots of the table. The number of slots is always a power of 2.
+  private: std::vector<Entry> entries;
+
+  /// The number of used slots.
+  private: Word count = 0;
+
+
+  //============================================================================
+  // Member Functions
+
+  /**
+   * @brief Look up the route cached for the given key.
+   *
+   * @param key The key of the token.
+   * @param route Receives the cached route, if found.
+   * @return Returns true if a route was cached for the given key.
+   */
+  public: Bool find(Word key, Int &route) const
+  {
+    if (this->count == 0) return false;
+    Word mask = this->entries.size() - 1;
+    for (Word i = DecisionTable::hash(key) & mask;; i = (i + 1) & mask) {
+      if (this->entries[i].key == key) {
+        route = this->entries[i].route;
+        return true;
+      } else if (this->entries[i].key == EMPTY_KEY) {
+        return false;
+      }
+    }
+  }
+
+  /// Cache the route taken for the given key, replacing any previous value.
+  public: void set(Word key, Int route);
+
+  public: void clear()
+  {
+    this->entries.clear();
+    this->count = 0;
+  }
+
+  public: Word getCount() const
+  {
+    return this->count;
+  }
+
+  private: void grow();
+
+  private: static Word hash(Word key)
+  {
+    // Token ids are dense, so mix the bits before masking.
+    return (key ^ (key >> 31)) * static_cast<Word>(0x9E3779B97F4A7C15ULL);
+  }
+
+}; // class
+
+} // namespace
+
+#endif
@@ -0,0 +1,135 @@
+/**
+ * @file Core/Data/Grammar/FirstSet.h
+ * Contains the header of class Core::Data::Grammar::FirstSet.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/alusus_license_1_0>.
+ */
+//==============================================================================
+
+#ifndef CORE_DATA_GRAMMAR_FIRSTSET_H
+#define CORE_DATA_GRAMMAR_FIRSTSET_H
+
+namespace Core::Data::Grammar
+{
+
+/**
+ * @brief The set of tokens a grammar term can start with.
+ * @ingroup core_data_grammar
+ *
+ * Each entry of the set is a token id and token text pair matched the same
+ * way token terms are matched, i.e. an id of 0 matches any id and a null text
+ * matches any text. The set also records whether the term can be completed
+ * without consuming any token, and whether the set could be fully determined.
+ * Sets that can't be determined (e.g. due to left recursion) can't be used to
+ * predict whether the term will accept a token.
+ *
+ * The values of terms depend on the arguments of the production they are in,
+ * so each set is associated with the args of the context it's computed in.
+ * @sa getFirstSet()
+ */
+class FirstSet
+{
+  //============================================================================
+  // Types
+
+  public: struct Entry
+  {
+    Word tokenId;
+    TiObject *tokenText;
+  };
+
+
+  //============================================================================
+  // Member Variables
+
+  /// The args of the context in which this set was computed.
+  private: TiObject *args;
+
+  private: std::vector<Entry> entries;
+
+  /// Whether the term can be completed without consuming any token.
+  private: Bool nullable = false;
+
+  /// Whether the set is known to be exact.
+  private: Bool determinate = true;
+
+  /// Whether the set is still being computed.
+  private: Bool analyzing = false;
+
+
+  //============================================================================
+  // Constructor
+
+  public: FirstSet(TiObject *args = 0) : args(args)
+  {
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  public: TiObject* getArgs() const
+  {
+    return this->args;
+  }
+
+  /// Add a token to the set, unless it's already in the set.
+  public: void add(Word tokenId, TiObject *tokenText)
+  {
+    for (auto const &entry : this->entries) {
+      if (entry.tokenId == tokenId && entry.tokenText == tokenText) return;
+    }
+    this->entries.push_back({ tokenId, tokenText });
+  }
+
+  /// Add the tokens of the given set to this set.
+  public: void merge(FirstSet const *set)
+  {
+    for (auto const &entry : set->entries) this->add(entry.tokenId, entry.tokenText);
+    if (!set->isDeterminate()) this->determinate = false;
+  }
+
+  public: std::vector<Entry> const& getEntries() const
+  {
+    return this->entries;
+  }
+
+  public: void setNullable(Bool n)
+  {
+    this->nullable = n;
+  }
+
+  public: Bool isNullable() const
+  {
+    return this->nullable;
+  }
+
+  public: void setDeterminate(Bool d)
+  {
+    this->determinate = d;
+  }
+
+  public: Bool isDeterminate() const
+  {
+    return this->determinate;
+  }
+
+  public: void setAnalyzing(Bool a)
+  {
+    this->analyzing = a;
+  }
+
+  public: Bool isAnalyzing() const
+  {
+    return this->analyzing;
+  }
+
+}; // class
+
+} // namespace
+
+#endif
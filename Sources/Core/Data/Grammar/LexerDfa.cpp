@@ -0,0 +1,567 @@
+/**
+ * @file Core/Data/Grammar/LexerDfa.cpp
+ * Contains the implementation of class Core::Data::Grammar::LexerDfa.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/alusus_license_1_0>.
+ */
+//==============================================================================
+
+#include <map>
+#include <algorithm>
+#include "core.h"
+
+namespace Core::Data::Grammar
+{
+
+//==============================================================================
+// Local Definitions
+
+namespace
+{
+
+/// The maximum number of NFA nodes before the compilation is abandoned.
+constexpr Int MAX_NFA_NODE_COUNT = 100000;
+
+/// The maximum number of DFA states before the compilation is abandoned.
+constexpr Int MAX_DFA_STATE_COUNT = 20000;
+
+/// The maximum number of copies a multiply term is unrolled into.
+constexpr Int MAX_MULTIPLY_UNROLL_COUNT = 32;
+
+typedef std::vector<std::pair<LongInt, LongInt>> CharRanges;
+
+struct NfaNode
+{
+  Int defIndex;
+  std::vector<Int> epsilons;
+  CharRanges ranges;
+  Int charTarget = -1;
+  Int acceptedDefIndex = -1;
+};
+
+} // namespace
+
+
+/**
+ * @brief A helper class that performs the DFA compilation.
+ *
+ * The compilation goes through the following steps:
+ * - Build a Thompson NFA for each root token definition. Definitions that
+ *   can't be compiled are dropped and left for the interpreted path.
+ * - Split the character space into classes with identical behavior.
+ * - Build the DFA using subset construction over character classes.
+ * - Minimize the DFA using partition refinement.
+ * - Generate the dense ASCII table and the range tables.
+ */
+class LexerDfaBuilder
+{
+  private: Context *context;
+  private: std::vector<NfaNode> nodes;
+  private: std::vector<SymbolDefinition*> referenceStack;
+  private: Int currentDefIndex = -1;
+
+  private: std::vector<Bool> constDefs;
+  private: std::vector<Bool> preferShorterDefs;
+
+  private: std::vector<LongInt> classBounds;
+  private: std::vector<std::vector<Int>> nodeClasses;
+
+  private: std::vector<Int> dfaAccepts;
+  private: std::vector<std::vector<Int>> dfaTransitions;
+
+  public: LexerDfaBuilder(Context *c) : context(c)
+  {
+  }
+
+  public: SharedPtr<LexerDfa> build(std::vector<Bool> &compiledDefs, Word &compiledDefCount);
+
+  private: Int addNode()
+  {
+    if (static_cast<Int>(this->nodes.size()) >= MAX_NFA_NODE_COUNT) {
+      throw EXCEPTION(GenericException, S("Lexer DFA node count limit exceeded."));
+    }
+    this->nodes.emplace_back();
+    this->nodes.back().defIndex = this->currentDefIndex;
+    return this->nodes.size() - 1;
+  }
+
+  private: void addEpsilon(Int from, Int to)
+  {
+    this->nodes[from].epsilons.push_back(to);
+  }
+
+  private: Bool buildTerm(Term *term, Int &start, Int &end);
+  private: Bool buildConstTerm(ConstTerm *term, Int &start, Int &end);
+  private: Bool buildCharGroupTerm(CharGroupTerm *term, Int &start, Int &end);
+  private: Bool buildConcatTerm(ConcatTerm *term, Int &start, Int &end);
+  private: Bool buildAlternateTerm(AlternateTerm *term, Int &start, Int &end);
+  private: Bool buildMultiplyTerm(MultiplyTerm *term, Int &start, Int &end);
+  private: Bool buildReferenceTerm(ReferenceTerm *term, Int &start, Int &end);
+
+  private: void computeClosure(std::vector<Int> &set);
+  private: void buildCharClasses();
+  private: Int findCharClass(LongInt ch) const;
+  private: Int getDfaState(
+    std::vector<Int> &set, std::map<std::vector<Int>, Int> &stateIds, std::vector<std::vector<Int>> &stateSets
+  );
+  private: Int selectBetterDef(Int def1, Int def2) const;
+  private: Bool buildDfa();
+  private: SharedPtr<LexerDfa> generateTables(std::vector<Bool> const &compiledDefs, Word compiledDefCount);
+};
+
+
+SharedPtr<LexerDfa> LexerDfaBuilder::build(std::vector<Bool> &compiledDefs, Word &compiledDefCount)
+{
+  auto module = this->context->getModule();
+  Word count = module->getCount();
+  compiledDefs.assign(count, false);
+  this->constDefs.assign(count, false);
+  this->preferShorterDefs.assign(count, false);
+
+  // Build the NFA fragments of all root tokens.
+  Int start = this->addNode();
+  std::vector<Int> defStarts(count, -1);
+  Bool allCompiled = true;
+  for (Word i = 0; i < count; ++i) {
+    TiObject *obj = module->getElement(i);
+    if (obj == 0 || !obj->isA<SymbolDefinition>()) continue;
+    SymbolDefinition *def = static_cast<SymbolDefinition*>(obj);
+    TiInt *flags = this->context->getSymbolFlags(def);
+    Int flagsValue = flags == 0 ? 0 : flags->get();
+    if (!(flagsValue & SymbolFlags::ROOT_TOKEN)) continue;
+
+    this->preferShorterDefs[i] = (flagsValue & SymbolFlags::PREFER_SHORTER) != 0;
+    this->constDefs[i] = def->getTerm() != 0 && def->getTerm()->isA<ConstTerm>();
+
+    this->currentDefIndex = i;
+    Word nodeCount = this->nodes.size();
+    Bool compiled = false;
+    try {
+      Int defStart, defEnd;
+      if (def->getTerm() != 0 && this->buildTerm(def->getTerm().get(), defStart, defEnd)) {
+        // Empty tokens aren't supported by the lexer.
+        std::vector<Int> closure = { defStart };
+        this->computeClosure(closure);
+        if (!std::binary_search(closure.begin(), closure.end(), defEnd)) {
+          this->nodes[defEnd].acceptedDefIndex = i;
+          defStarts[i] = defStart;
+          compiled = true;
+        }
+      }
+    } catch (Exception &e) {
+      compiled = false;
+    }
+    this->referenceStack.clear();
+    if (!compiled) {
+      this->nodes.resize(nodeCount);
+      allCompiled = false;
+    }
+  }
+
+  // When some tokens are left to the interpreted path we can't know at compile time whether a
+  // PREFER_SHORTER token wins against those tokens, so we leave such tokens to the interpreted path
+  // as well.
+  compiledDefCount = 0;
+  for (Word i = 0; i < count; ++i) {
+    if (defStarts[i] == -1) continue;
+    if (!allCompiled && this->preferShorterDefs[i]) continue;
+    compiledDefs[i] = true;
+    ++compiledDefCount;
+    this->addEpsilon(start, defStarts[i]);
+  }
+  if (compiledDefCount == 0) return SharedPtr<LexerDfa>();
+
+  this->buildCharClasses();
+  if (!this->buildDfa()) return SharedPtr<LexerDfa>();
+  auto dfa = this->generateTables(compiledDefs, compiledDefCount);
+  dfa->complete = allCompiled;
+  return dfa;
+}
+
+
+Bool LexerDfaBuilder::buildTerm(Term *term, Int &start, Int &end)
+{
+  if (term == 0) return false;
+  if (term->isA<ConstTerm>()) {
+    return this->buildConstTerm(static_cast<ConstTerm*>(term), start, end);
+  } else if (term->isA<CharGroupTerm>()) {
+    return this->buildCharGroupTerm(static_cast<CharGroupTerm*>(term), start, end);
+  } else if (term->isA<ConcatTerm>()) {
+    return this->buildConcatTerm(static_cast<ConcatTerm*>(term), start, end);
+  } else if (term->isA<AlternateTerm>()) {
+    return this->buildAlternateTerm(static_cast<AlternateTerm*>(term), start, end);
+  } else if (term->isA<MultiplyTerm>()) {
+    return this->buildMultiplyTerm(static_cast<MultiplyTerm*>(term), start, end);
+  } else if (term->isA<ReferenceTerm>()) {
+    return this->buildReferenceTerm(static_cast<ReferenceTerm*>(term), start, end);
+  } else {
+    return false;
+  }
+}
+
+
+Bool LexerDfaBuilder::buildConstTerm(ConstTerm *term, Int &start, Int &end)
+{
+  auto const &matchString = term->getMatchString();
+  if (matchString.size() == 0) return false;
+  start = this->addNode();
+  end = start;
+  for (Word i = 0; i < matchString.size(); ++i) {
+    Int next = this->addNode();
+    this->nodes[end].ranges.push_back({ matchString[i], matchString[i] });
+    this->nodes[end].charTarget = next;
+    end = next;
+  }
+  return true;
+}
+
+
+Bool LexerDfaBuilder::buildCharGroupTerm(CharGroupTerm *term, Int &start, Int &end)
+{
+  Reference *ref = term->getCharGroupReference().get();
+  if (ref == 0) return false;
+  CharGroupDefinition *def = this->context->getReferencedCharGroup(ref);
+  if (def == 0 || def->getCharGroupUnit() == 0) return false;
+  auto const &charGroupRanges = def->getCompiledCharGroup()->getRanges();
+  if (charGroupRanges.empty()) return false;
+  start = this->addNode();
+  end = this->addNode();
+  for (auto const &range : charGroupRanges) this->nodes[start].ranges.push_back({ range.start, range.end });
+  this->nodes[start].charTarget = end;
+  return true;
+}
+
+
+Bool LexerDfaBuilder::buildConcatTerm(ConcatTerm *term, Int &start, Int &end)
+{
+  auto list = term->getTerms().get();
+  if (list == 0 || list->getCount() == 0) return false;
+  for (Word i = 0; i < list->getCount(); ++i) {
+    Int childStart, childEnd;
+    if (!this->buildTerm(ti_cast<Term>(list->getElement(i)), childStart, childEnd)) return false;
+    if (i == 0) start = childStart;
+    else this->addEpsilon(end, childStart);
+    end = childEnd;
+  }
+  return true;
+}
+
+
+Bool LexerDfaBuilder::buildAlternateTerm(AlternateTerm *term, Int &start, Int &end)
+{
+  auto list = term->getTerms().get();
+  if (list == 0 || list->getCount() < 2) return false;
+  start = this->addNode();
+  end = this->addNode();
+  for (Word i = 0; i < list->getCount(); ++i) {
+    Int childStart, childEnd;
+    if (!this->buildTerm(ti_cast<Term>(list->getElement(i)), childStart, childEnd)) return false;
+    this->addEpsilon(start, childStart);
+    this->addEpsilon(childEnd, end);
+  }
+  return true;
+}
+
+
+Bool LexerDfaBuilder::buildMultiplyTerm(MultiplyTerm *term, Int &start, Int &end)
+{
+  Term *innerTerm = term->getTerm().get();
+  if (innerTerm == 0) return false;
+
+  Int minCount = 0;
+  if (term->getMin() != 0) {
+    TiInt *min = this->context->getMultiplyTermMin(term);
+    if (min == 0) return false;
+    minCount = min->get();
+  }
+  Bool bounded = term->getMax() != 0;
+  Int maxCount = 0;
+  if (bounded) {
+    TiInt *max = this->context->getMultiplyTermMax(term);
+    if (max == 0) return false;
+    maxCount = max->get();
+  }
+  if (minCount < 0 || (bounded && maxCount < minCount)) return false;
+  if (minCount + (bounded ? maxCount - minCount : 1) > MAX_MULTIPLY_UNROLL_COUNT) return false;
+
+  start = this->addNode();
+  end = start;
+  Int childStart, childEnd;
+  // Mandatory occurances.
+  for (Int i = 0; i < minCount; ++i) {
+    if (!this->buildTerm(innerTerm, childStart, childEnd)) return false;
+    this->addEpsilon(end, childStart);
+    end = childEnd;
+  }
+  if (bounded) {
+    // Optional occurances.
+    for (Int i = minCount; i < maxCount; ++i) {
+      if (!this->buildTerm(innerTerm, childStart, childEnd)) return false;
+      Int exit = this->addNode();
+      this->addEpsilon(end, childStart);
+      this->addEpsilon(end, exit);
+      this->addEpsilon(childEnd, exit);
+      end = exit;
+    }
+  } else {
+    // Unlimited occurances.
+    if (!this->buildTerm(innerTerm, childStart, childEnd)) return false;
+    Int loop = this->addNode();
+    Int exit = this->addNode();
+    this->addEpsilon(end, loop);
+    this->addEpsilon(loop, childStart);
+    this->addEpsilon(loop, exit);
+    this->addEpsilon(childEnd, loop);
+    end = exit;
+  }
+  return true;
+}
+
+
+Bool LexerDfaBuilder::buildReferenceTerm(ReferenceTerm *term, Int &start, Int &end)
+{
+  Reference *ref = term->getReference().get();
+  if (ref == 0) return false;
+  SymbolDefinition *def = this->context->getReferencedSymbol(ref);
+  if (def == 0 || def->getTerm() == 0) return false;
+  // References to other modules aren't supported by the lexer.
+  if (def->findOwner<Module>() != this->context->getModule()) return false;
+  // Recursive references can't be represented by a finite automaton.
+  if (std::find(this->referenceStack.begin(), this->referenceStack.end(), def) != this->referenceStack.end()) {
+    return false;
+  }
+  this->referenceStack.push_back(def);
+  Bool result = this->buildTerm(def->getTerm().get(), start, end);
+  this->referenceStack.pop_back();
+  return result;
+}
+
+
+/// Extend the given set of NFA nodes with all epsilon reachable nodes and sort it.
+void LexerDfaBuilder::computeClosure(std::vector<Int> &set)
+{
+  std::vector<Bool> visited(this->nodes.size(), false);
+  std::vector<Int> stack(set);
+  set.clear();
+  while (!stack.empty()) {
+    Int node = stack.back();
+    stack.pop_back();
+    if (visited[node]) continue;
+    visited[node] = true;
+    set.push_back(node);
+    for (auto target : this->nodes[node].epsilons) {
+      if (!visited[target]) stack.push_back(target);
+    }
+  }
+  std::sort(set.begin(), set.end());
+}
+
+
+/// Split the character space into classes of characters that behave identically in the NFA.
+void LexerDfaBuilder::buildCharClasses()
+{
+  this->classBounds.clear();
+  this->classBounds.push_back(WCHAR_MIN);
+  for (auto const &node : this->nodes) {
+    for (auto const &range : node.ranges) {
+      this->classBounds.push_back(range.first);
+      if (range.second < WCHAR_MAX) this->classBounds.push_back(range.second + 1);
+    }
+  }
+  std::sort(this->classBounds.begin(), this->classBounds.end());
+  this->classBounds.erase(std::unique(this->classBounds.begin(), this->classBounds.end()), this->classBounds.end());
+
+  this->nodeClasses.assign(this->nodes.size(), std::vector<Int>());
+  for (Word i = 0; i < this->nodes.size(); ++i) {
+    for (auto const &range : this->nodes[i].ranges) {
+      Int first = this->findCharClass(range.first);
+      Int last = this->findCharClass(range.second);
+      for (Int c = first; c <= last; ++c) this->nodeClasses[i].push_back(c);
+    }
+  }
+}
+
+
+Int LexerDfaBuilder::findCharClass(LongInt ch) const
+{
+  auto iter = std::upper_bound(this->classBounds.begin(), this->classBounds.end(), ch);
+  return (iter - this->classBounds.begin()) - 1;
+}
+
+
+/**
+ * Select the better of two token definitions matching the same number of
+ * characters. This follows the same rules as Lexer::selectBestToken.
+ */
+Int LexerDfaBuilder::selectBetterDef(Int def1, Int def2) const
+{
+  if (def1 == -1) return def2;
+  if (def2 == -1) return def1;
+  if (this->constDefs[def1] != this->constDefs[def2]) return this->constDefs[def1] ? def1 : def2;
+  return def1 < def2 ? def1 : def2;
+}
+
+
+/**
+ * Get the DFA state for the given set of NFA nodes, creating it if needed.
+ * The DFA state is identified by the accepted token and the set of nodes
+ * that still have character transitions.
+ * @return The index of the state, or -1 if the set represents a dead state.
+ */
+Int LexerDfaBuilder::getDfaState(
+  std::vector<Int> &set, std::map<std::vector<Int>, Int> &stateIds, std::vector<std::vector<Int>> &stateSets
+) {
+  this->computeClosure(set);
+  Int accepted = -1;
+  for (auto node : set) {
+    accepted = this->selectBetterDef(accepted, this->nodes[node].acceptedDefIndex);
+  }
+  // Once a PREFER_SHORTER token is selected, the lexer drops the remaining routes of the same token.
+  Int droppedDef = (accepted != -1 && this->preferShorterDefs[accepted]) ? accepted : -1;
+  std::vector<Int> key;
+  key.push_back(accepted);
+  for (auto node : set) {
+    if (this->nodes[node].charTarget == -1) continue;
+    if (this->nodes[node].defIndex == droppedDef) continue;
+    key.push_back(node);
+  }
+  if (accepted == -1 && key.size() == 1) return -1;
+
+  auto iter = stateIds.find(key);
+  if (iter != stateIds.end()) return iter->second;
+  if (static_cast<Int>(stateSets.size()) >= MAX_DFA_STATE_COUNT) {
+    throw EXCEPTION(GenericException, S("Lexer DFA state count limit exceeded."));
+  }
+  Int id = stateSets.size();
+  stateSets.push_back(std::vector<Int>(key.begin() + 1, key.end()));
+  this->dfaAccepts.push_back(accepted);
+  stateIds[std::move(key)] = id;
+  return id;
+}
+
+
+/// Build the unminimized DFA using subset construction.
+Bool LexerDfaBuilder::buildDfa()
+{
+  std::map<std::vector<Int>, Int> stateIds;
+  std::vector<std::vector<Int>> stateSets;
+  Word classCount = this->classBounds.size();
+  try {
+    std::vector<Int> startSet = { 0 };
+    if (this->getDfaState(startSet, stateIds, stateSets) != 0) return false;
+    std::vector<std::vector<Int>> targets(classCount);
+    for (Word s = 0; s < stateSets.size(); ++s) {
+      for (auto &t : targets) t.clear();
+      for (auto node : stateSets[s]) {
+        for (auto c : this->nodeClasses[node]) targets[c].push_back(this->nodes[node].charTarget);
+      }
+      std::vector<Int> transitions(classCount, -1);
+      for (Word c = 0; c < classCount; ++c) {
+        if (targets[c].empty()) continue;
+        transitions[c] = this->getDfaState(targets[c], stateIds, stateSets);
+      }
+      this->dfaTransitions.push_back(std::move(transitions));
+    }
+  } catch (Exception &e) {
+    return false;
+  }
+  return true;
+}
+
+
+/// Minimize the DFA and generate the final tables.
+SharedPtr<LexerDfa> LexerDfaBuilder::generateTables(std::vector<Bool> const &compiledDefs, Word compiledDefCount)
+{
+  Word stateCount = this->dfaAccepts.size();
+  Word classCount = this->classBounds.size();
+
+  // Minimize using partition refinement, starting with partitions based on the accepted token.
+  std::vector<Int> partitions(stateCount);
+  Word partitionCount = 0;
+  {
+    std::map<Int, Int> ids;
+    for (Word s = 0; s < stateCount; ++s) {
+      auto iter = ids.find(this->dfaAccepts[s]);
+      if (iter == ids.end()) iter = ids.insert({ this->dfaAccepts[s], ids.size() }).first;
+      partitions[s] = iter->second;
+    }
+    partitionCount = ids.size();
+  }
+  while (true) {
+    std::map<std::vector<Int>, Int> ids;
+    std::vector<Int> newPartitions(stateCount);
+    std::vector<Int> signature(classCount + 1);
+    for (Word s = 0; s < stateCount; ++s) {
+      signature[0] = partitions[s];
+      for (Word c = 0; c < classCount; ++c) {
+        Int target = this->dfaTransitions[s][c];
+        signature[c + 1] = target == -1 ? -1 : partitions[target];
+      }
+      auto iter = ids.find(signature);
+      if (iter == ids.end()) iter = ids.insert({ signature, ids.size() }).first;
+      newPartitions[s] = iter->second;
+    }
+    partitions = std::move(newPartitions);
+    if (ids.size() == partitionCount) break;
+    partitionCount = ids.size();
+  }
+
+  // Generate the tables. Partitions are numbered by first appearance, so the start state remains 0.
+  auto dfa = std::make_shared<LexerDfa>();
+  dfa->compiledDefs = compiledDefs;
+  dfa->compiledDefCount = compiledDefCount;
+  dfa->asciiTransitions.assign(partitionCount << 7, -1);
+  dfa->rangeTransitions.assign(partitionCount, std::vector<LexerDfa::Range>());
+  dfa->acceptedDefIndexes.assign(partitionCount, -1);
+  std::vector<Bool> generated(partitionCount, false);
+  for (Word s = 0; s < stateCount; ++s) {
+    Int p = partitions[s];
+    if (generated[p]) continue;
+    generated[p] = true;
+    dfa->acceptedDefIndexes[p] = this->dfaAccepts[s];
+    auto const &transitions = this->dfaTransitions[s];
+    for (Int ch = 0; ch < 128; ++ch) {
+      Int target = transitions[this->findCharClass(ch)];
+      dfa->asciiTransitions[(p << 7) + ch] = target == -1 ? -1 : partitions[target];
+    }
+    auto &ranges = dfa->rangeTransitions[p];
+    for (Word c = 0; c < classCount; ++c) {
+      Int target = transitions[c];
+      if (target == -1) continue;
+      target = partitions[target];
+      LongInt low = this->classBounds[c];
+      LongInt high = c + 1 < classCount ? this->classBounds[c + 1] - 1 : WCHAR_MAX;
+      LongInt pieces[2][2] = { { low, std::min(high, LongInt(-1)) }, { std::max(low, LongInt(128)), high } };
+      for (auto const &piece : pieces) {
+        if (piece[0] > piece[1]) continue;
+        if (!ranges.empty() && ranges.back().target == target && ranges.back().end + 1 == piece[0]) {
+          ranges.back().end = piece[1];
+        } else {
+          ranges.push_back({ static_cast<WChar>(piece[0]), static_cast<WChar>(piece[1]), target });
+        }
+      }
+    }
+  }
+  return dfa;
+}
+
+
+//==============================================================================
+// Member Functions
+
+SharedPtr<LexerDfa> LexerDfa::create(Context *context)
+{
+  if (context == 0 || context->getModule() == 0) {
+    throw EXCEPTION(InvalidArgumentException, S("context"), S("Context or its module is null."));
+  }
+  std::vector<Bool> compiledDefs;
+  Word compiledDefCount;
+  LexerDfaBuilder builder(context);
+  return builder.build(compiledDefs, compiledDefCount);
+}
+
+} // namespace
@@ -0,0 +1,157 @@
+/**
+ * @file Core/Data/Grammar/LexerDfa.h
+ * Contains the header of class Core::Data::Grammar::LexerDfa.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/alusus_license_1_0>.
+ */
+//==============================================================================
+
+#ifndef CORE_DATA_GRAMMAR_LEXERDFA_H
+#define CORE_DATA_GRAMMAR_LEXERDFA_H
+
+namespace Core::Data::Grammar
+{
+
+/**
+ * @brief A table driven DFA compiled from the root tokens of a lexer module.
+ * @ingroup core_data_grammar
+ *
+ * This class holds a minimized deterministic finite automaton that recognizes
+ * the root tokens of a LexerModule (including inherited token definitions).
+ * Transitions on ASCII characters are stored in a dense table while
+ * transitions on other characters are stored in a sorted list of ranges per
+ * state. Each state records the token definition that is accepted once the
+ * state is reached, using the same selection rules the lexer applies when
+ * multiple tokens of the same length are matched.
+ *
+ * Token definitions that can't be compiled (recursive references, references
+ * to other modules, unsupported term types, etc.) are left out of the DFA and
+ * are expected to be handled by the lexer's interpreted path. Use isCompiled()
+ * to check whether a given token definition is covered by the DFA.
+ */
+class LexerDfa
+{
+  friend class LexerDfaBuilder;
+
+  //============================================================================
+  // Types
+
+  /// A transition on a range of non ASCII characters.
+  public: struct Range
+  {
+    WChar start;
+    WChar end;
+    Int target;
+  };
+
+
+  //============================================================================
+  // Member Variables
+
+  /// Transitions on ASCII characters, 128 entries per state.
+  private: std::vector<Int> asciiTransitions;
+
+  /// Transitions on non ASCII characters, sorted by start character.
+  private: std::vector<std::vector<Range>> rangeTransitions;
+
+  /// The index of the token definition accepted at each state, or -1.
+  private: std::vector<Int> acceptedDefIndexes;
+
+  /// Whether each lexer module element is handled by this DFA.
+  private: std::vector<Bool> compiledDefs;
+
+  private: Word compiledDefCount = 0;
+
+  /// Whether all the root tokens of the module are handled by this DFA.
+  private: Bool complete = false;
+
+
+  //============================================================================
+  // Constructor
+
+  public: LexerDfa()
+  {
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  /**
+   * @brief Compile the root tokens of the given context's module.
+   *
+   * The module of the given context must be the lexer module to compile.
+   * @return A new DFA object, or null if none of the root tokens could be
+   *         compiled, or if the automaton turned out to be too large.
+   */
+  public: static SharedPtr<LexerDfa> create(Context *context);
+
+  /// Get the starting state of the DFA.
+  public: Int getStartState() const
+  {
+    return 0;
+  }
+
+  /**
+   * @brief Get the state following the given state on the given character.
+   * @return The index of the next state, or -1 if the character is rejected.
+   */
+  public: Int getNextState(Int state, WChar ch) const
+  {
+    if (ch >= 0 && ch < 128) return this->asciiTransitions[(state << 7) + ch];
+    auto const &ranges = this->rangeTransitions[state];
+    Int low = 0;
+    Int high = static_cast<Int>(ranges.size()) - 1;
+    while (low <= high) {
+      Int mid = (low + high) / 2;
+      if (ch < ranges[mid].start) high = mid - 1;
+      else if (ch > ranges[mid].end) low = mid + 1;
+      else return ranges[mid].target;
+    }
+    return -1;
+  }
+
+  /// Get the index of the token definition accepted at the given state, or -1.
+  public: Int getAcceptedDefIndex(Int state) const
+  {
+    return this->acceptedDefIndexes[state];
+  }
+
+  /// Check whether the token definition at the given module index is compiled.
+  public: Bool isCompiled(Int defIndex) const
+  {
+    return defIndex >= 0 && defIndex < static_cast<Int>(this->compiledDefs.size()) && this->compiledDefs[defIndex];
+  }
+
+  /// Get the number of token definitions covered by this DFA.
+  public: Word getCompiledDefCount() const
+  {
+    return this->compiledDefCount;
+  }
+
+  /**
+   * @brief Check whether all the root tokens of the module are compiled.
+   *
+   * A complete DFA handles every token on its own, so a lexer using it never
+   * needs to interpret grammar terms or consult the module's decision cache.
+   */
+  public: Bool isComplete() const
+  {
+    return this->complete;
+  }
+
+  /// Get the number of states in this DFA.
+  public: Word getStateCount() const
+  {
+    return this->acceptedDefIndexes.size();
+  }
+
+}; // class
+
+} // namespace
+
+#endif
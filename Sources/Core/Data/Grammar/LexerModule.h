@@ -40,6 +40,12 @@ class LexerModule : public Module, public CacheHaving
 
   private: CharBasedDecisionCache charBasedDecisionCache;
 
+  /// The DFA compiled from the root tokens of this module.
+  private: SharedPtr<LexerDfa> dfa;
+
+  /// Whether the DFA compilation was attempted since the last change.
+  private: Bool dfaCompiled = false;
+
 
   //============================================================================
   // Constructor & Destructor
@@ -75,6 +81,49 @@ class LexerModule : public Module, public CacheHaving
     return &this->charBasedDecisionCache;
   }
 
+  /**
+   * @brief Get the DFA compiled from the root tokens of this module.
+   *
+   * The DFA is compiled on first use and is reset whenever the module or the
+   * grammar changes. The returned value can be null if none of the root
+   * tokens could be compiled.
+   *
+   * @param context The grammar context to use for the compilation. The
+   *                module of the context must be this module.
+   */
+  public: SharedPtr<LexerDfa> const& getDfa(Context *context)
+  {
+    if (!this->dfaCompiled) {
+      this->dfa = LexerDfa::create(context);
+      this->dfaCompiled = true;
+    }
+    return this->dfa;
+  }
+
+  private: void resetDfa()
+  {
+    this->dfa.reset();
+    this->dfaCompiled = false;
+  }
+
+
+  //============================================================================
+  // Module Overrides
+
+  protected: virtual void finalizeSet(
+    Char const *key, Int index, SharedPtr<TiObject> const &obj, Bool inherited, Bool newEntry
+  ) {
+    Module::finalizeSet(key, index, obj, inherited, newEntry);
+    this->resetDfa();
+  }
+
+  protected: virtual void prepareForUnset(
+    Char const *key, Int index, SharedPtr<TiObject> const &obj, Bool inherited
+  ) {
+    Module::prepareForUnset(key, index, obj, inherited);
+    this->resetDfa();
+  }
+
 
   //============================================================================
   // CacheHaving Implementation
@@ -83,6 +132,7 @@ class LexerModule : public Module, public CacheHaving
   public: virtual void clearCache()
   {
     this->charBasedDecisionCache.clear();
+    this->resetDfa();
   }
 
 }; // class
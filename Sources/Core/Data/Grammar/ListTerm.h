@@ -32,13 +32,13 @@ namespace Core::Data::Grammar
  * either be done through a list of boolean flags, a flag for each term, or
  * through a single index number that specifies the single enabled term.
  */
-class ListTerm : public Term, public MapContaining<TiObject>
+class ListTerm : public Term, public MapContaining<TiObject>, public CacheHaving
 {
   //============================================================================
   // Type Info
 
   TYPE_INFO(ListTerm, Term, "Core.Data.Grammar", "Core", "alusus.org", (
-    INHERITANCE_INTERFACES(MapContaining<TiObject>)
+    INHERITANCE_INTERFACES(MapContaining<TiObject>, CacheHaving)
   ));
 
 
@@ -51,6 +51,9 @@ class ListTerm : public Term, public MapContaining<TiObject>
   /// @sa getData()
   protected: SharedPtr<Node> filter;
 
+  /// The FIRST sets of this term, one for each context it was analyzed in.
+  private: std::vector<SharedPtr<FirstSet>> firstSets;
+
 
   //============================================================================
   // Implementations
@@ -120,6 +123,21 @@ class ListTerm : public Term, public MapContaining<TiObject>
     return this->filter;
   }
 
+  public: std::vector<SharedPtr<FirstSet>>* getFirstSets()
+  {
+    return &this->firstSets;
+  }
+
+
+  //============================================================================
+  // CacheHaving Implementation
+
+  /// @sa CacheHaving::clearCache()
+  public: virtual void clearCache()
+  {
+    this->firstSets.clear();
+  }
+
 }; // class
 
 } // namespace
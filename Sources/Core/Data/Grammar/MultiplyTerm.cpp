@@ -55,8 +55,8 @@ void MultiplyTerm::setMax(SharedPtr<TiObject> const &m)
 
 void MultiplyTerm::clearCache()
 {
-  this->innerTextBasedDecisionCache.clear();
-  this->innerIdBasedDecisionCache.clear();
+  this->decisionTable.clear();
+  this->firstSets.clear();
 }
 
 } // namespace
@@ -42,13 +42,6 @@ class MultiplyTerm : public Term, public CacheHaving, public MapContaining<TiObj
   OBJECT_FACTORY(MultiplyTerm);
 
 
-  //============================================================================
-  // Types
-
-  public: typedef std::unordered_map<Str, Int, std::hash<std::string>> TextBasedDecisionCache;
-  public: typedef std::unordered_map<Word, Int> IdBasedDecisionCache;
-
-
   //============================================================================
   // Member Variables
 
@@ -58,9 +51,11 @@ class MultiplyTerm : public Term, public CacheHaving, public MapContaining<TiObj
 
   private: TioSharedPtr max;
 
-  private: TextBasedDecisionCache innerTextBasedDecisionCache;
+  /// The routes previously taken at this term, keyed by token.
+  private: DecisionTable decisionTable;
 
-  private: IdBasedDecisionCache innerIdBasedDecisionCache;
+  /// The FIRST sets of this term, one for each context it was analyzed in.
+  private: std::vector<SharedPtr<FirstSet>> firstSets;
 
 
   //============================================================================
@@ -139,14 +134,14 @@ class MultiplyTerm : public Term, public CacheHaving, public MapContaining<TiObj
     return this->max;
   }
 
-  public: TextBasedDecisionCache* getInnerTextBasedDecisionCache()
+  public: DecisionTable* getDecisionTable()
   {
-    return &this->innerTextBasedDecisionCache;
+    return &this->decisionTable;
   }
 
-  public: IdBasedDecisionCache* getInnerIdBasedDecisionCache()
+  public: std::vector<SharedPtr<FirstSet>>* getFirstSets()
   {
-    return &this->innerIdBasedDecisionCache;
+    return &this->firstSets;
   }
 
 
@@ -1546,7 +1546,7 @@ void StandardFactory::createSubjectProductionModule()
     })},
     {S("handler"), std::make_shared<CustomParsingHandler>([](Parser *parser, ParserState *state) {
       auto current = state->getData().ti_cast_get<Ast::Token>();
-      SharedPtr<Ast::Text> newObj = std::make_shared<Ast::Identifier>();
+      SharedPtr<Ast::Text> newObj = newSharedObject<Ast::Identifier>();
       newObj->setValue(current->getText());
       newObj->setProdId(current->getProdId());
       newObj->setSourceLocation(current->findSourceLocation());
@@ -1573,13 +1573,13 @@ void StandardFactory::createSubjectProductionModule()
       auto current = state->getData().ti_cast_get<Ast::Token>();
       SharedPtr<Ast::Text> newObj;
       if (current->getId() == ID_GENERATOR->getId(S("LexerDefs.IntLiteral"))) {
-        newObj = std::make_shared<Ast::IntegerLiteral>();
+        newObj = newSharedObject<Ast::IntegerLiteral>();
       } else if (current->getId() == ID_GENERATOR->getId(S("LexerDefs.FloatLiteral"))) {
-        newObj = std::make_shared<Ast::FloatLiteral>();
+        newObj = newSharedObject<Ast::FloatLiteral>();
       } else if (current->getId() == ID_GENERATOR->getId(S("LexerDefs.CharLiteral"))) {
-        newObj = std::make_shared<Ast::CharLiteral>();
+        newObj = newSharedObject<Ast::CharLiteral>();
       } else if (current->getId() == ID_GENERATOR->getId(S("LexerDefs.StringLiteral"))) {
-        newObj = std::make_shared<Ast::StringLiteral>();
+        newObj = newSharedObject<Ast::StringLiteral>();
       }
       newObj->setValue(current->getText());
       newObj->setProdId(current->getProdId());
@@ -1889,6 +1889,15 @@ void StandardFactory::createMainProductionModule(Bool exprOnly)
 }
 
 
+Word StandardFactory::addConstToken(Char const *text)
+{
+  Word id = Factory::addConstToken(text);
+  // Intern the text now so the const token handler is never modified while lexing.
+  this->constTokenHandler->setTextId(id, ID_GENERATOR->getId(text));
+  return id;
+}
+
+
 SharedPtr<SymbolDefinition> StandardFactory::createConstTokenDef(Char const *text)
 {
   if (SBSTR(text) == S("@") || SBSTR(text) == S("@<")) {
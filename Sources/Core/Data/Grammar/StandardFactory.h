@@ -91,6 +91,9 @@ class StandardFactory : public Factory
   /// Create Main production module.
   private: void createMainProductionModule(Bool exprOnly);
 
+  /// Add a const token and register its text id with the ConstTokenizingHandler.
+  protected: virtual Word addConstToken(Char const *text);
+
   /// Create a const token that uses the ConstTokenizingHandler.
   protected: virtual SharedPtr<SymbolDefinition> createConstTokenDef(Char const *text);
 
@@ -137,6 +137,150 @@ Bool matchCharGroup(WChar ch, CharGroupUnit *unit)
 }
 
 
+namespace
+{
+
+/// The maximum depth of nested terms followed while computing a FIRST set.
+Int const MAX_FIRST_SET_DEPTH = 512;
+
+void computeFirstSet(Term *term, Context *context, Int depth, FirstSet *result);
+
+/**
+ * Get the FIRST set of a term, using the memoized set if the term supports
+ * memoization, or computing it into the given buffer otherwise.
+ */
+FirstSet const* findFirstSet(Term *term, Context *context, Int depth, FirstSet *buffer)
+{
+  std::vector<SharedPtr<FirstSet>> *sets = 0;
+  if (term->isDerivedFrom<ListTerm>()) sets = static_cast<ListTerm*>(term)->getFirstSets();
+  else if (term->isA<MultiplyTerm>()) sets = static_cast<MultiplyTerm*>(term)->getFirstSets();
+  if (sets == 0) {
+    computeFirstSet(term, context, depth, buffer);
+    return buffer;
+  }
+
+  for (auto const &set : *sets) {
+    if (set->getArgs() == context->getArgs()) {
+      if (set->isAnalyzing()) {
+        // We are back at a term we are still analyzing, i.e. the grammar is left recursive.
+        buffer->setDeterminate(false);
+        return buffer;
+      }
+      return set.get();
+    }
+  }
+
+  auto set = std::make_shared<FirstSet>(context->getArgs());
+  sets->push_back(set);
+  set->setAnalyzing(true);
+  computeFirstSet(term, context, depth, set.get());
+  set->setAnalyzing(false);
+  return set.get();
+}
+
+
+/**
+ * Compute the FIRST set of a term. The computation follows the same rules the
+ * parser follows when testing routes in Parser::testState.
+ */
+void computeFirstSet(Term *term, Context *context, Int depth, FirstSet *result)
+{
+  if (depth > MAX_FIRST_SET_DEPTH) {
+    result->setDeterminate(false);
+    return;
+  }
+
+  if (term->isA<TokenTerm>()) {
+    auto tokenTerm = static_cast<TokenTerm*>(term);
+    Word matchId = context->getTokenTermId(tokenTerm)->get();
+    TiObject *matchText = context->getTokenTermText(tokenTerm);
+    if (matchId == UNKNOWN_ID && matchText == 0) result->setDeterminate(false);
+    else result->add(matchId, matchText);
+  } else if (term->isA<AlternateTerm>()) {
+    // An alternate term accepts what any of its routes accept. An alternate term with no routes always fails.
+    auto listTerm = static_cast<ListTerm*>(term);
+    TiObject *filter = context->getListTermFilter(listTerm);
+    Word count = context->getListTermChildCount(listTerm, filter);
+    for (Word i = 0; i < count; ++i) {
+      FirstSet buffer;
+      auto childSet = findFirstSet(context->getListTermChild(listTerm, i, filter), context, depth + 1, &buffer);
+      result->merge(childSet);
+      if (childSet->isNullable()) result->setNullable(true);
+    }
+  } else if (term->isA<ConcatTerm>()) {
+    // A concat term accepts what its terms accept up to and including the first non nullable term.
+    auto listTerm = static_cast<ListTerm*>(term);
+    TiObject *filter = context->getListTermFilter(listTerm);
+    Word count = context->getListTermChildCount(listTerm, filter);
+    result->setNullable(true);
+    for (Word i = 0; i < count; ++i) {
+      FirstSet buffer;
+      auto childSet = findFirstSet(context->getListTermChild(listTerm, i, filter), context, depth + 1, &buffer);
+      result->merge(childSet);
+      if (!childSet->isNullable()) {
+        result->setNullable(false);
+        break;
+      }
+    }
+  } else if (term->isA<MultiplyTerm>()) {
+    auto multiplyTerm = static_cast<MultiplyTerm*>(term);
+    TiInt *max = context->getMultiplyTermMax(multiplyTerm);
+    TiInt *min = context->getMultiplyTermMin(multiplyTerm);
+    if (max != 0 && max->get() == 0) {
+      // The inner route is disabled.
+      result->setNullable(true);
+      return;
+    }
+    if (multiplyTerm->getTerm() == 0) {
+      result->setDeterminate(false);
+      return;
+    }
+    FirstSet buffer;
+    auto childSet = findFirstSet(multiplyTerm->getTerm().get(), context, depth + 1, &buffer);
+    result->merge(childSet);
+    if (min == 0 || min->get() < 1) result->setNullable(true);
+    // The parser treats an empty iteration as a failed one, so we can't predict terms that need a minimum number of
+    // iterations of a nullable term.
+    else if (childSet->isNullable()) result->setDeterminate(false);
+  } else if (term->isA<ReferenceTerm>()) {
+    auto definition = context->getReferencedSymbol(static_cast<ReferenceTerm*>(term)->getReference().get());
+    // Empty productions always fail.
+    if (definition->getTerm() == 0) return;
+    // Analyze the production's term in the same context the parser will use when entering the production.
+    Context prodContext;
+    prodContext.copyFrom(context);
+    prodContext.setModule(definition->findOwner<Module>());
+    prodContext.setArgs(prodContext.getSymbolVars(definition));
+    FirstSet buffer;
+    auto childSet = findFirstSet(definition->getTerm().get(), &prodContext, depth + 1, &buffer);
+    result->merge(childSet);
+    result->setNullable(childSet->isNullable());
+  } else {
+    result->setDeterminate(false);
+  }
+}
+
+} // namespace
+
+
+FirstSet const* getFirstSet(Term *term, Context const *context, FirstSet *buffer)
+{
+  ASSERT(term != 0);
+  ASSERT(buffer != 0);
+
+  Context analysisContext;
+  analysisContext.copyFrom(context);
+  try {
+    return findFirstSet(term, &analysisContext, 0, buffer);
+  } catch (Exception &e) {
+    // The term refers to parts of the grammar that aren't valid or aren't complete yet, which the parser will only
+    // complain about if it actually reaches them, so we'll just leave the decision to the parser.
+    buffer->setDeterminate(false);
+    return buffer;
+  }
+}
+
+
 void setTreeIds(TiObject *obj)
 {
   StrStream stream;
@@ -27,7 +27,10 @@ namespace Core::Data::Grammar
 {
   class Reference;
   class Module;
+  class Context;
   class CharGroupUnit;
+  class Term;
+  class FirstSet;
 }
 
 namespace Core::Processing::Handlers
@@ -107,6 +110,24 @@ Module* getGrammarRoot(DynamicContaining<TiObject> *rootScope, Bool createIfMiss
  */
 Bool matchCharGroup(WChar ch, CharGroupUnit *unit);
 
+/**
+ * @brief Get the set of tokens a given term can start with.
+ * @ingroup core_data_grammar
+ * Computes the FIRST set of the given term within the given context. Sets of
+ * alternate, concat, and multiply terms are memoized on the terms themselves
+ * and are only recomputed after the term's cache is cleared, which happens
+ * when the grammar is modified. Sets of other terms are computed into the
+ * given buffer.
+ *
+ * @param term The term to analyze.
+ * @param context The grammar context in which the term is visited by the
+ *                parser.
+ * @param buffer The set to use if the result can't be memoized.
+ * @return Returns the FIRST set of the term. The returned set is flagged as
+ *         not determinate if the analysis couldn't compute it exactly.
+ */
+FirstSet const* getFirstSet(Term *term, Context const *context, FirstSet *buffer);
+
 /**
  * @brief Set the IDs of all elements in a given tree.
  * @ingroup core_data_grammar
@@ -175,6 +196,7 @@ template <class T> SharedPtr<T> cloneInherited(SharedPtr<T> const &obj)
 #include "List.h"
 #include "Map.h"
 #include "Module.h"
+#include "LexerDfa.h"
 #include "LexerModule.h"
 
 // Character Groups
@@ -183,12 +205,15 @@ template <class T> SharedPtr<T> cloneInherited(SharedPtr<T> const &obj)
 #include "RandomCharGroupUnit.h"
 #include "UnionCharGroupUnit.h"
 #include "InvertCharGroupUnit.h"
+#include "CompiledCharGroup.h"
 #include "CharGroupDefinition.h"
 
 // Terms
 #include "Term.h"
 #include "ConstTerm.h"
 #include "CharGroupTerm.h"
+#include "DecisionTable.h"
+#include "FirstSet.h"
 #include "ListTerm.h"
 #include "ConcatTerm.h"
 #include "AlternateTerm.h"
@@ -16,28 +16,115 @@ namespace Core { namespace Data
 {
 
 //==============================================================================
-// Member Function
+// Member Functions
 
 Word IdGenerator::getId(Char const *desc)
 {
-  Int id = this->index.find(Str(desc));
-  if (id == -1) {
-    this->ids.push_back(Desc());
-    this->ids.back().str = desc;
-    this->index.add();
-    return this->ids.size()-1;
-  } else {
-    return static_cast<Word>(id);
+  Word hash = IdGenerator::hash(desc);
+  Stripe &stripe = this->stripes[hash % STRIPE_COUNT];
+  Int id = this->findId(stripe.table.load(std::memory_order_acquire), desc, hash);
+  if (id != -1) return static_cast<Word>(id);
+
+  std::lock_guard<std::mutex> lock(stripe.mutex);
+  // Another thread could have added the desc before we got the lock.
+  id = this->findId(stripe.table.load(std::memory_order_relaxed), desc, hash);
+  if (id != -1) return static_cast<Word>(id);
+
+  Word newId = this->count.fetch_add(1, std::memory_order_relaxed);
+  Word chunkIndex = newId / CHUNK_SIZE;
+  if (chunkIndex >= MAX_CHUNK_COUNT) {
+    throw EXCEPTION(GenericException, S("Maximum number of ids reached."));
+  }
+  auto chunk = this->chunks[chunkIndex].load(std::memory_order_acquire);
+  if (chunk == 0) {
+    auto newChunk = new std::atomic<Str const*>[CHUNK_SIZE];
+    for (Word i = 0; i < CHUNK_SIZE; ++i) newChunk[i].store(0, std::memory_order_relaxed);
+    if (this->chunks[chunkIndex].compare_exchange_strong(chunk, newChunk, std::memory_order_acq_rel)) {
+      chunk = newChunk;
+    } else {
+      // Another stripe allocated the chunk first.
+      delete[] newChunk;
+    }
   }
+  chunk[newId % CHUNK_SIZE].store(new Str(desc), std::memory_order_release);
+  this->insertId(stripe, hash, newId);
+  return newId;
 }
 
 
 Str const& IdGenerator::getDesc(Word id) const
 {
-  if (id >= this->ids.size()) {
+  auto desc = this->findDesc(id);
+  if (desc == 0) {
     throw EXCEPTION(InvalidArgumentException, S("id"), S("No desc available for this id."), id);
   }
-  return this->ids[id].str;
+  return *desc;
+}
+
+
+Str const* IdGenerator::findDesc(Word id) const
+{
+  if (id >= this->count.load(std::memory_order_acquire)) return 0;
+  auto chunk = this->chunks[id / CHUNK_SIZE].load(std::memory_order_acquire);
+  if (chunk == 0) return 0;
+  return chunk[id % CHUNK_SIZE].load(std::memory_order_acquire);
+}
+
+
+Int IdGenerator::findId(Table const *table, Char const *desc, Word hash) const
+{
+  if (table == 0) return -1;
+  Word mask = table->size - 1;
+  for (Word pos = (hash / STRIPE_COUNT) & mask;; pos = (pos + 1) & mask) {
+    LongWord slot = table->slots[pos].load(std::memory_order_acquire);
+    if (slot == 0) return -1;
+    if (static_cast<Word>(slot >> 32) != hash) continue;
+    Word id = static_cast<Word>(slot) - 1;
+    if (this->findDesc(id)->compare(desc) == 0) return id;
+  }
+}
+
+
+/**
+ * Must be called while holding the stripe's lock. If the table is half full
+ * it's replaced with a table of double the size before adding the new id.
+ */
+void IdGenerator::insertId(Stripe &stripe, Word hash, Word id)
+{
+  auto table = stripe.table.load(std::memory_order_relaxed);
+  if (table == 0 || (stripe.count + 1) * 2 > table->size) {
+    auto newTable = new Table;
+    newTable->size = table == 0 ? 64 : table->size * 2;
+    newTable->slots = new std::atomic<LongWord>[newTable->size];
+    for (Word i = 0; i < newTable->size; ++i) newTable->slots[i].store(0, std::memory_order_relaxed);
+    Word newMask = newTable->size - 1;
+    if (table != 0) {
+      for (Word i = 0; i < table->size; ++i) {
+        LongWord slot = table->slots[i].load(std::memory_order_relaxed);
+        if (slot == 0) continue;
+        Word pos = (static_cast<Word>(slot >> 32) / STRIPE_COUNT) & newMask;
+        while (newTable->slots[pos].load(std::memory_order_relaxed) != 0) pos = (pos + 1) & newMask;
+        newTable->slots[pos].store(slot, std::memory_order_relaxed);
+      }
+      stripe.retiredTables.push_back(table);
+    }
+    stripe.table.store(newTable, std::memory_order_release);
+    table = newTable;
+  }
+  Word mask = table->size - 1;
+  Word pos = (hash / STRIPE_COUNT) & mask;
+  while (table->slots[pos].load(std::memory_order_relaxed) != 0) pos = (pos + 1) & mask;
+  table->slots[pos].store((static_cast<LongWord>(hash) << 32) | (id + 1), std::memory_order_release);
+  ++stripe.count;
+}
+
+
+/// Compute the FNV-1a hash of the given desc.
+Word IdGenerator::hash(Char const *desc)
+{
+  Word hash = 2166136261u;
+  for (Char const *c = desc; *c != 0; ++c) hash = (hash ^ static_cast<unsigned char>(*c)) * 16777619u;
+  return hash;
 }
 
 
@@ -28,34 +28,71 @@ namespace Core { namespace Data
  * to generate the required ids guarantees that no two objects will have the
  * same id.<br>
  * This is used by grammar definitions.
+ *
+ * This class can be used from multiple threads at the same time. Lookups of
+ * existing ids and descs don't take any locks. Descs are hashed into
+ * STRIPE_COUNT stripes, each with its own open addressing hash table and its
+ * own lock for adding new ids, so adding ids to different stripes doesn't
+ * contend. Descs are stored in fixed size chunks that never move, so ids and
+ * descs stay valid for the lifetime of the process.
  */
 class IdGenerator
 {
+  //============================================================================
+  // Constants
+
+  private: static constexpr Word STRIPE_COUNT = 16;
+
+  /// The number of descs in each chunk of the desc storage.
+  private: static constexpr Word CHUNK_SIZE = 1024;
+
+  private: static constexpr Word MAX_CHUNK_COUNT = 4096;
+
+
   //============================================================================
   // Data Types
 
-  private: struct Desc
+  /**
+   * @brief An open addressing hash table of ids.
+   *
+   * Each slot holds the desc's hash in its upper half and the id + 1 in its
+   * lower half, or 0 if empty. Tables are never modified other than filling
+   * empty slots, and are replaced by bigger tables when they fill up.
+   */
+  private: struct Table
   {
-    Str str;
+    Word size;
+    std::atomic<LongWord> *slots;
   };
 
-  private: typedef DirectSortedIndex<Desc, Str, &Desc::str> Index;
+  private: struct Stripe
+  {
+    std::atomic<Table*> table = { 0 };
+    Word count = 0;
+    std::mutex mutex;
+    /// Replaced tables. These are kept since readers might still be using them.
+    std::vector<Table*> retiredTables;
+  };
 
 
   //============================================================================
   // Member Variables
 
-  private: std::vector<Desc> ids;
+  private: Stripe stripes[STRIPE_COUNT];
 
-  private: Index index;
+  private: std::atomic<std::atomic<Str const*>*> chunks[MAX_CHUNK_COUNT];
+
+  /// The number of ids given so far, including ids whose descs are still being stored.
+  private: std::atomic<Word> count = { 0 };
 
 
   //============================================================================
   // Constructor
 
   /// Prevent the singleton class from being inistantiated.
-  private: IdGenerator() : index(&ids)
+  private: IdGenerator()
   {
+    for (Word i = 0; i < MAX_CHUNK_COUNT; ++i) this->chunks[i].store(0, std::memory_order_relaxed);
     this->getId(S("UNKNOWN"));
   }
 
@@ -65,13 +102,21 @@ class IdGenerator
 
   public: Bool isDefined(Word id) const
   {
-    return id < this->ids.size();
+    return this->findDesc(id) != 0;
   }
 
   public: Word getId(Char const *desc);
 
   public: Str const& getDesc(Word id) const;
 
+  private: Str const* findDesc(Word id) const;
+
+  private: Int findId(Table const *table, Char const *desc, Word hash) const;
+
+  private: void insertId(Stripe &stripe, Word hash, Word id);
+
+  private: static Word hash(Char const *desc);
+
   /// Get the singleton object.
   public: static IdGenerator* getSingleton();
 
@@ -29,6 +29,13 @@ class Node : public TiObject
   TYPE_INFO(Node, TiObject, "Core.Data", "Core", "alusus.org");
 
 
+  //============================================================================
+  // Constants
+
+  /// Data nodes are created in large numbers by the parser, so they are allocated from slabs.
+  public: static constexpr Bool SLAB_ALLOCATED = true;
+
+
   //============================================================================
   // Member Variables
 
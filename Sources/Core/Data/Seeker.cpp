@@ -83,6 +83,107 @@ void Seeker::initBindings()
 }
 
 
+//==============================================================================
+// Cache Functions
+
+Seeker::Verb Seeker::foreachCached(TiObject const *ref, TiObject *target, ForeachCallback const &cb, Word flags)
+{
+  // Only searches starting from AST nodes are cached since other targets, like data stacks, are transient.
+  CacheKey key;
+  if (!target->isDerivedFrom<Node>() || !Seeker::getCacheRefAtom(ref, key.ref)) {
+    return this->foreachUncached(ref, target, cb, flags);
+  }
+  key.target = target;
+  key.flags = flags;
+
+  Word generation = Ast::getAstGeneration();
+  Word skipCount = 0;
+  auto iter = this->cache.find(key);
+  if (iter != this->cache.end() && iter->second.generation == generation) {
+    // Keep a reference to the results since the callback could replace the cache entry.
+    auto results = iter->second.results;
+    Bool complete = iter->second.complete;
+    if (complete) ++this->cacheHitCount;
+    for (auto obj : *results) {
+      auto verb = cb(obj, 0);
+      if (!Seeker::isMove(verb)) {
+        if (!complete) ++this->cacheHitCount;
+        return verb;
+      }
+    }
+    if (complete) return Verb::MOVE;
+    // The cached search was stopped early, so continue searching after the cached matches.
+    skipCount = results->size();
+  }
+  ++this->cacheMissCount;
+
+  auto results = std::make_shared<std::vector<TiObject*>>();
+  Bool cacheable = true;
+  auto verb = this->foreachUncached(ref, target, [&](TiObject *obj, Notices::Notice *notice)->Verb {
+    // Notices are owned by the search that raised them, so searches that raise notices can't be cached.
+    if (notice != 0) cacheable = false;
+    results->push_back(obj);
+    if (results->size() <= skipCount) return Verb::MOVE;
+    return cb(obj, notice);
+  }, flags);
+
+  if (cacheable && Ast::getAstGeneration() == generation) {
+    auto &entry = this->cache[key];
+    entry.generation = generation;
+    entry.complete = Seeker::isMove(verb);
+    entry.results = results;
+  }
+  return verb;
+}
+
+
+Seeker::Verb Seeker::foreachUncached(TiObject const *ref, TiObject *target, ForeachCallback const &cb, Word flags)
+{
+  if (ref->isA<Ast::Identifier>()) {
+    return this->foreachByIdentifier(static_cast<Ast::Identifier const*>(ref), target, cb, flags);
+  } else if (ref->isA<Ast::LinkOperator>()) {
+    return this->foreachByLinkOperator(static_cast<Ast::LinkOperator const*>(ref), target, cb, flags);
+  } else {
+    throw EXCEPTION(InvalidArgumentException, S("ref"), S("Unrecognized reference type."));
+  }
+}
+
+
+/**
+ * @brief Get the atom used to key the cached results of the given reference.
+ * Only identifiers and chains of identifiers joined by the dot operator are
+ * cached. Identifiers are keyed by their own atoms, while chains are keyed by
+ * the atom of their joined text. References of bridges are excluded since the
+ * search skips the bridge that owns the reference being searched for.
+ * @return Returns false if the reference can't be cached.
+ */
+Bool Seeker::getCacheRefAtom(TiObject const *ref, Char const *&atom)
+{
+  if (!ref->isDerivedFrom<Node>()) return false;
+  auto node = static_cast<Node const*>(ref);
+  if (node->getOwner() != 0 && node->getOwner()->isDerivedFrom<Ast::Bridge>()) return false;
+  if (node->isA<Ast::Identifier>()) {
+    atom = static_cast<Ast::Identifier const*>(node)->getAtom();
+    return true;
+  }
+  Str text;
+  while (node->isA<Ast::LinkOperator>()) {
+    auto link = static_cast<Ast::LinkOperator const*>(node);
+    auto second = link->getSecond().get();
+    if (link->getType() != S(".") || second == 0 || !second->isA<Ast::Identifier>()) return false;
+    auto first = link->getFirst().get();
+    if (first == 0 || !first->isDerivedFrom<Node>()) return false;
+    text.insert(0, static_cast<Ast::Identifier*>(second)->getValue().getStr());
+    text.insert(0, S("."));
+    node = static_cast<Node const*>(first);
+  }
+  if (!node->isA<Ast::Identifier>()) return false;
+  text.insert(0, static_cast<Ast::Identifier const*>(node)->getValue().getStr());
+  atom = ATOM_TABLE->getAtom(text.c_str(), text.size());
+  return true;
+}
+
+
 //==============================================================================
 // Helper Functions
 
@@ -171,13 +272,8 @@ Seeker::Verb Seeker::_foreach(
   TiObject *self, TiObject const *ref, TiObject *target, ForeachCallback const &cb, Word flags
 ) {
   PREPARE_SELF(seeker, Seeker);
-  if (ref->isA<Ast::Identifier>()) {
-    return seeker->foreachByIdentifier(static_cast<Ast::Identifier const*>(ref), target, cb, flags);
-  } else if (ref->isA<Ast::LinkOperator>()) {
-    return seeker->foreachByLinkOperator(static_cast<Ast::LinkOperator const*>(ref), target, cb, flags);
-  } else {
-    throw EXCEPTION(InvalidArgumentException, S("ref"), S("Unrecognized reference type."));
-  }
+  if (seeker->cacheEnabled) return seeker->foreachCached(ref, target, cb, flags);
+  else return seeker->foreachUncached(ref, target, cb, flags);
 }
 
 
@@ -229,16 +325,15 @@ Seeker::Verb Seeker::_setByIdentifier_scope(
   TiObject *self, Data::Ast::Identifier const *identifier, Ast::Scope *scope, SetCallback const &cb, Word flags
 ) {
   Seeker::Verb verb = Seeker::Verb::MOVE;
-  for (Int i = 0; i < scope->getCount(); ++i) {
-    auto def = ti_cast<Data::Ast::Definition>(scope->getElement(i));
-    if (def != 0 && def->getName() == identifier->getValue()) {
-      auto obj = def->getTarget().get();
-      verb = cb(obj, 0);
-      if (isPerform(verb)) {
-        def->setTarget(getSharedPtr(obj));
-      }
-      if (!Seeker::isMove(verb)) break;
+  auto nameAtom = identifier->getAtom();
+  for (Int i = scope->findDefinitionIndex(nameAtom); i != -1; i = scope->findDefinitionIndex(nameAtom, i + 1)) {
+    auto def = static_cast<Data::Ast::Definition*>(scope->getElement(i));
+    auto obj = def->getTarget().get();
+    verb = cb(obj, 0);
+    if (isPerform(verb)) {
+      def->setTarget(getSharedPtr(obj));
     }
+    if (!Seeker::isMove(verb)) break;
   }
   if (Seeker::isMove(verb)) {
     TiObject *obj = 0;
@@ -303,17 +398,16 @@ Seeker::Verb Seeker::_removeByIdentifier_scope(
   TiObject *self, Data::Ast::Identifier const *identifier, Ast::Scope *scope, RemoveCallback const &cb, Word flags
 ) {
   Seeker::Verb verb = Seeker::Verb::MOVE;
-  for (Int i = 0; i < scope->getCount(); ++i) {
-    auto def = ti_cast<Data::Ast::Definition>(scope->getElement(i));
-    if (def != 0 && def->getName() == identifier->getValue()) {
-      auto obj = def->getTarget().get();
-      verb = cb(obj, 0);
-      if (isPerform(verb)) {
-        scope->remove(i);
-        --i;
-      }
-      if (!Seeker::isMove(verb)) return verb;
+  auto nameAtom = identifier->getAtom();
+  for (Int i = scope->findDefinitionIndex(nameAtom); i != -1; i = scope->findDefinitionIndex(nameAtom, i + 1)) {
+    auto def = static_cast<Data::Ast::Definition*>(scope->getElement(i));
+    auto obj = def->getTarget().get();
+    verb = cb(obj, 0);
+    if (isPerform(verb)) {
+      scope->remove(i);
+      --i;
     }
+    if (!Seeker::isMove(verb)) return verb;
   }
   return verb;
 }
@@ -367,21 +461,20 @@ Seeker::Verb Seeker::_foreachByIdentifier_scope(
   TiObject *self, Data::Ast::Identifier const *identifier, Ast::Scope *scope, ForeachCallback const &cb, Word flags
 ) {
   Seeker::Verb verb = Seeker::Verb::MOVE;
-  for (Int i = 0; i < scope->getCount(); ++i) {
-    auto def = ti_cast<Data::Ast::Definition>(scope->getElement(i));
-    if (def != 0 && def->getName() == identifier->getValue()) {
-      auto obj = def->getTarget().get();
-      if (obj->isDerivedFrom<Ast::Alias>()) {
-        PREPARE_SELF(seeker, Seeker);
-        auto alias = static_cast<Ast::Alias*>(obj);
-        verb = seeker->foreach(
-          alias->getReference().get(), alias->getOwner(), cb, flags & ~(Flags::SKIP_OWNERS | Flags::SKIP_OWNED)
-        );
-        if (!Seeker::isMove(verb)) return verb;
-      } else {
-        verb = cb(obj, 0);
-        if (!Seeker::isMove(verb)) return verb;
-      }
+  auto nameAtom = identifier->getAtom();
+  for (Int i = scope->findDefinitionIndex(nameAtom); i != -1; i = scope->findDefinitionIndex(nameAtom, i + 1)) {
+    auto def = static_cast<Data::Ast::Definition*>(scope->getElement(i));
+    auto obj = def->getTarget().get();
+    if (obj->isDerivedFrom<Ast::Alias>()) {
+      PREPARE_SELF(seeker, Seeker);
+      auto alias = static_cast<Ast::Alias*>(obj);
+      verb = seeker->foreach(
+        alias->getReference().get(), alias->getOwner(), cb, flags & ~(Flags::SKIP_OWNERS | Flags::SKIP_OWNED)
+      );
+      if (!Seeker::isMove(verb)) return verb;
+    } else {
+      verb = cb(obj, 0);
+      if (!Seeker::isMove(verb)) return verb;
     }
   }
 
@@ -458,16 +551,15 @@ Seeker::Verb Seeker::_setByLinkOperator_scopeDotIdentifier(
   TiObject *self, Ast::Identifier const *identifier, Ast::Scope *scope, SetCallback const &cb, Word flags
 ) {
   Verb verb = Verb::MOVE;
-  for (Int i = 0; i < scope->getCount(); ++i) {
-    auto def = ti_cast<Data::Ast::Definition>(scope->getElement(i));
-    if (def != 0 && def->getName() == identifier->getValue()) {
-      auto obj = def->getTarget().get();
-      verb = cb(obj, 0);
-      if (isPerform(verb)) {
-        def->setTarget(getSharedPtr(obj));
-      }
-      if (!Seeker::isMove(verb)) break;
+  auto nameAtom = identifier->getAtom();
+  for (Int i = scope->findDefinitionIndex(nameAtom); i != -1; i = scope->findDefinitionIndex(nameAtom, i + 1)) {
+    auto def = static_cast<Data::Ast::Definition*>(scope->getElement(i));
+    auto obj = def->getTarget().get();
+    verb = cb(obj, 0);
+    if (isPerform(verb)) {
+      def->setTarget(getSharedPtr(obj));
     }
+    if (!Seeker::isMove(verb)) break;
   }
   if (Seeker::isMove(verb)) {
     TiObject *obj = 0;
@@ -548,17 +640,16 @@ Seeker::Verb Seeker::_removeByLinkOperator_scopeDotIdentifier(
   TiObject *self, Data::Ast::Identifier const *identifier, Data::Ast::Scope *scope, RemoveCallback const &cb, Word flags
 ) {
   Verb verb = Verb::MOVE;
-  for (Int i = 0; i < scope->getCount(); ++i) {
-    auto def = ti_cast<Data::Ast::Definition>(scope->getElement(i));
-    if (def != 0 && def->getName() == identifier->getValue()) {
-      auto obj = def->getTarget().get();
-      verb = cb(obj, 0);
-      if (isPerform(verb)) {
-        scope->remove(i);
-        --i;
-      }
-      if (!Seeker::isMove(verb)) break;
+  auto nameAtom = identifier->getAtom();
+  for (Int i = scope->findDefinitionIndex(nameAtom); i != -1; i = scope->findDefinitionIndex(nameAtom, i + 1)) {
+    auto def = static_cast<Data::Ast::Definition*>(scope->getElement(i));
+    auto obj = def->getTarget().get();
+    verb = cb(obj, 0);
+    if (isPerform(verb)) {
+      scope->remove(i);
+      --i;
     }
+    if (!Seeker::isMove(verb)) break;
   }
   return verb;
 }
@@ -631,21 +722,20 @@ Seeker::Verb Seeker::_foreachByLinkOperator_scopeDotIdentifier(
   TiObject *self, Data::Ast::Identifier *identifier, Data::Ast::Scope *scope, ForeachCallback const &cb, Word flags
 ) {
   Verb verb = Verb::MOVE;
-  for (Int i = 0; i < scope->getCount(); ++i) {
-    auto def = ti_cast<Data::Ast::Definition>(scope->getElement(i));
-    if (def != 0 && def->getName() == identifier->getValue()) {
-      auto obj = def->getTarget().get();
-      if (obj->isDerivedFrom<Ast::Alias>()) {
-        PREPARE_SELF(seeker, Seeker);
-        auto alias = static_cast<Ast::Alias*>(obj);
-        verb = seeker->foreach(
-          alias->getReference().get(), alias->getOwner(), cb, flags & ~(Flags::SKIP_OWNERS | Flags::SKIP_OWNED)
-        );
-        if (!Seeker::isMove(verb)) break;
-      } else {
-        verb = cb(obj, 0);
-        if (!Seeker::isMove(verb)) break;
-      }
+  auto nameAtom = identifier->getAtom();
+  for (Int i = scope->findDefinitionIndex(nameAtom); i != -1; i = scope->findDefinitionIndex(nameAtom, i + 1)) {
+    auto def = static_cast<Data::Ast::Definition*>(scope->getElement(i));
+    auto obj = def->getTarget().get();
+    if (obj->isDerivedFrom<Ast::Alias>()) {
+      PREPARE_SELF(seeker, Seeker);
+      auto alias = static_cast<Ast::Alias*>(obj);
+      verb = seeker->foreach(
+        alias->getReference().get(), alias->getOwner(), cb, flags & ~(Flags::SKIP_OWNERS | Flags::SKIP_OWNED)
+      );
+      if (!Seeker::isMove(verb)) break;
+    } else {
+      verb = cb(obj, 0);
+      if (!Seeker::isMove(verb)) break;
     }
   }
   return verb;
@@ -38,6 +38,58 @@ class Seeker : public TiObject, public DynamicBinding, public DynamicInterfacing
   public: typedef std::function<Verb(TiObject *obj, Notices::Notice *notice)> RemoveCallback;
   public: typedef std::function<Verb(TiObject *obj, Notices::Notice *notice)> ForeachCallback;
 
+  /// The key of a cached resolution; the reference is keyed by its text, e.g. `Srl.Memory.alloc`.
+  private: struct CacheKey
+  {
+    /// The atom of the reference's text.
+    Char const *ref;
+    TiObject *target;
+    Word flags;
+
+    Bool operator==(CacheKey const &key) const
+    {
+      return this->target == key.target && this->flags == key.flags && this->ref == key.ref;
+    }
+  };
+
+  private: struct CacheKeyHasher
+  {
+    std::size_t operator()(CacheKey const &key) const
+    {
+      return std::hash<Char const*>()(key.ref) ^ (std::hash<TiObject*>()(key.target) << 1) ^ key.flags;
+    }
+  };
+
+  /**
+   * @brief The objects a reference resolved to, in the order they were found.
+   * The entry is incomplete if the search was stopped before visiting all
+   * matches, in which case only the visited matches are cached.
+   */
+  private: struct CacheEntry
+  {
+    Word generation;
+    Bool complete;
+    SharedPtr<std::vector<TiObject*>> results;
+  };
+
+
+  //============================================================================
+  // Member Variables
+
+  /**
+   * @brief Cached results of foreach calls on identifiers and link operators.
+   * Entries are only valid while the AST generation they were cached at is
+   * current.
+   * @sa Ast::getAstGeneration()
+   */
+  private: std::unordered_map<CacheKey, CacheEntry, CacheKeyHasher> cache;
+
+  private: Bool cacheEnabled = true;
+
+  private: Word cacheHitCount = 0;
+
+  private: Word cacheMissCount = 0;
+
 
   //============================================================================
   // Implementations
@@ -75,6 +127,57 @@ class Seeker : public TiObject, public DynamicBinding, public DynamicInterfacing
 
   /// @}
 
+  /// @name Cache Functions
+  /// @{
+
+  /// Enable or disable caching of foreach results, e.g. for debugging.
+  public: void setCacheEnabled(Bool enabled)
+  {
+    this->cacheEnabled = enabled;
+    if (!enabled) this->cache.clear();
+  }
+
+  public: Bool isCacheEnabled() const
+  {
+    return this->cacheEnabled;
+  }
+
+  public: void clearCache()
+  {
+    this->cache.clear();
+  }
+
+  /// The number of foreach calls fully served from the cache.
+  public: Word getCacheHitCount() const
+  {
+    return this->cacheHitCount;
+  }
+
+  /// The number of foreach calls that needed a search despite being cacheable.
+  public: Word getCacheMissCount() const
+  {
+    return this->cacheMissCount;
+  }
+
+  public: Word getCacheEntryCount() const
+  {
+    return this->cache.size();
+  }
+
+  public: void resetCacheStats()
+  {
+    this->cacheHitCount = 0;
+    this->cacheMissCount = 0;
+  }
+
+  private: Verb foreachCached(TiObject const *ref, TiObject *target, ForeachCallback const &cb, Word flags);
+
+  private: Verb foreachUncached(TiObject const *ref, TiObject *target, ForeachCallback const &cb, Word flags);
+
+  private: static Bool getCacheRefAtom(TiObject const *ref, Char const *&atom);
+
+  /// @}
+
   /// @name Helper Functions
   /// @{
 
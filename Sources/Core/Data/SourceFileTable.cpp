@@ -0,0 +1,71 @@
+/**
+ * @file Core/Data/SourceFileTable.cpp
+ * Contains the implementation of class Core::Data::SourceFileTable.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/alusus_license_1_0>.
+ */
+//==============================================================================
+
+#include "core.h"
+
+namespace Core { namespace Data
+{
+
+//==============================================================================
+// Member Functions
+
+Word SourceFileTable::getFileId(Char const *filename)
+{
+  if (filename == 0 || *filename == 0) return 0;
+  auto atom = ATOM_TABLE->getAtom(filename);
+  {
+    std::shared_lock<std::shared_mutex> lock(this->mutex);
+    auto i = this->ids.find(atom);
+    if (i != this->ids.end()) return i->second;
+  }
+  std::unique_lock<std::shared_mutex> lock(this->mutex);
+  // Another thread could have added the file while the lock was released.
+  auto i = this->ids.find(atom);
+  if (i != this->ids.end()) return i->second;
+  Word id = this->filenames.size();
+  this->filenames.push_back(atom);
+  this->ids[atom] = id;
+  return id;
+}
+
+
+Char const* SourceFileTable::getFilename(Word fileId) const
+{
+  std::shared_lock<std::shared_mutex> lock(this->mutex);
+  if (fileId >= this->filenames.size()) {
+    throw EXCEPTION(InvalidArgumentException, S("fileId"), S("Out of range."), fileId);
+  }
+  return this->filenames[fileId];
+}
+
+
+Word SourceFileTable::getCount() const
+{
+  std::shared_lock<std::shared_mutex> lock(this->mutex);
+  return this->filenames.size();
+}
+
+
+SourceFileTable* SourceFileTable::getSingleton()
+{
+  static SourceFileTable *sourceFileTable = 0;
+  if (sourceFileTable == 0) {
+    sourceFileTable = reinterpret_cast<SourceFileTable*>(GLOBAL_STORAGE->getObject(S("Core::Data::SourceFileTable")));
+    if (sourceFileTable == 0) {
+      sourceFileTable = new SourceFileTable;
+      GLOBAL_STORAGE->setObject(S("Core::Data::SourceFileTable"), reinterpret_cast<void*>(sourceFileTable));
+    }
+  }
+  return sourceFileTable;
+}
+
+} } // namespace
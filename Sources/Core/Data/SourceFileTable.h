@@ -0,0 +1,74 @@
+/**
+ * @file Core/Data/SourceFileTable.h
+ * Contains the header of class Core::Data::SourceFileTable.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/alusus_license_1_0>.
+ */
+//==============================================================================
+
+#ifndef CORE_DATA_SOURCEFILETABLE_H
+#define CORE_DATA_SOURCEFILETABLE_H
+
+namespace Core { namespace Data
+{
+
+/**
+ * @brief A table of the names of source files.
+ * @ingroup core_data
+ *
+ * Source locations refer to their files using ids from this table instead of
+ * holding the files' names, which keeps them small and allows copying them
+ * without touching any reference counts. Id 0 refers to no file and has an
+ * empty name. Files are never removed from the table, so ids and the names
+ * returned for them stay valid for the lifetime of the process.
+ *
+ * This singleton class can be used from multiple threads at the same time.
+ */
+class SourceFileTable
+{
+  //============================================================================
+  // Member Variables
+
+  /// The atoms of the file names, indexed by file id.
+  private: std::vector<Char const*> filenames;
+
+  /// File ids keyed by the atoms of the file names.
+  private: std::unordered_map<Char const*, Word> ids;
+
+  private: mutable std::shared_mutex mutex;
+
+
+  //============================================================================
+  // Constructor
+
+  /// Prevent the singleton class from being inistantiated.
+  private: SourceFileTable() : filenames({ S("") })
+  {
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  /// Get the id of the given file, adding the file to the table if needed.
+  public: Word getFileId(Char const *filename);
+
+  /// Get the name of the file with the given id.
+  public: Char const* getFilename(Word fileId) const;
+
+  public: Word getCount() const;
+
+  /// Get the singleton object.
+  public: static SourceFileTable* getSingleton();
+
+}; // class
+
+} } // namespace
+
+#define SOURCE_FILE_TABLE Core::Data::SourceFileTable::getSingleton()
+
+#endif
@@ -49,13 +49,43 @@ class Token : public Node
    * If the token is not a constant string, this value will contain the token
    * text, otherwise it will be empty.
    */
-  private: Str text;
+  private: mutable Str text;
+
+  /**
+   * @brief A view into the source code holding the token text.
+   *
+   * When the lexer works on a contiguous source buffer it points the token
+   * to its text within that buffer instead of copying it. The text is copied
+   * into the text member the first time it's requested.
+   * @sa setTextView()
+   */
+  private: mutable Char const *textView = 0;
+
+  /// The length in bytes of the text pointed to by textView.
+  private: mutable Word textViewLength = 0;
 
   /// The location of the token in the source code.
   private: SourceLocationRecord sourceLocation;
 
   private: Bool aKeyword = false;
 
+  /**
+   * @brief The interned id of the token text.
+   *
+   * Tokenizing handlers that already know the interned id of the text can set
+   * it directly, otherwise it's interned the first time it's requested.
+   * @sa getTextId()
+   */
+  private: mutable Word textId = UNKNOWN_ID;
+
+  /**
+   * @brief The atom of the token text within the atom table.
+   *
+   * Interned the first time it's requested.
+   * @sa getTextAtom()
+   */
+  private: mutable Char const *textAtom = 0;
+
 
   //============================================================================
   // Constructor / Destructor
@@ -102,6 +132,9 @@ class Token : public Node
   public: void setText(Char const *t)
   {
     this->text = t;
+    this->textView = 0;
+    this->textId = UNKNOWN_ID;
+    this->textAtom = 0;
   }
 
   /**
@@ -112,6 +145,9 @@ class Token : public Node
   public: void setText(WChar const *t)
   {
     this->text.assign(t);
+    this->textView = 0;
+    this->textId = UNKNOWN_ID;
+    this->textAtom = 0;
   }
 
   /**
@@ -123,6 +159,9 @@ class Token : public Node
   public: void setText(Char const *t, Int s)
   {
     this->text.assign(t, s);
+    this->textView = 0;
+    this->textId = UNKNOWN_ID;
+    this->textAtom = 0;
   }
 
   /**
@@ -134,6 +173,9 @@ class Token : public Node
   public: void setText(WChar const *t, Int s)
   {
     this->text.assign(t, s);
+    this->textView = 0;
+    this->textId = UNKNOWN_ID;
+    this->textAtom = 0;
   }
 
   /**
@@ -143,9 +185,86 @@ class Token : public Node
    */
   public: Str const& getText() const
   {
+    if (this->textView != 0) {
+      this->text.assign(this->textView, this->textViewLength);
+      this->textView = 0;
+    }
     return this->text;
   }
 
+  /**
+   * Set the token text as a view into a source buffer.
+   *
+   * The text is not copied until getText() is called, so the given buffer
+   * must remain valid until the token is consumed.
+   *
+   * @param t A pointer to the token text within the source buffer.
+   * @param s The size of the text in bytes.
+   */
+  public: void setTextView(Char const *t, Word s)
+  {
+    this->textView = t;
+    this->textViewLength = s;
+    this->textId = UNKNOWN_ID;
+    this->textAtom = 0;
+  }
+
+  /**
+   * @brief Get a pointer to the characters of the token text.
+   *
+   * Unlike getText(), this doesn't copy the text if it's a view into a source
+   * buffer, so the returned characters aren't necessarily null terminated.
+   * @sa getTextLength()
+   */
+  public: Char const* getTextBuffer() const
+  {
+    return this->textView != 0 ? this->textView : this->text.c_str();
+  }
+
+  /// Get the length in bytes of the token text.
+  public: Word getTextLength() const
+  {
+    return this->textView != 0 ? this->textViewLength : this->text.size();
+  }
+
+  /// Check whether the token text is currently a view into a source buffer.
+  public: Bool isTextView() const
+  {
+    return this->textView != 0;
+  }
+
+  /// Set the interned id of the token text.
+  public: void setTextId(Word id)
+  {
+    this->textId = id;
+  }
+
+  /**
+   * @brief Get the interned id of the token text.
+   *
+   * Tokens with the same text will always have the same text id, which allows
+   * comparing or hashing token text without looking at the text itself.
+   */
+  public: Word getTextId() const
+  {
+    if (this->textId == UNKNOWN_ID) this->textId = ID_GENERATOR->getId(this->getText().c_str());
+    return this->textId;
+  }
+
+  /**
+   * @brief Get the atom of the token text.
+   *
+   * Tokens with the same text will always have the same atom, so token texts
+   * can be compared by pointer. Unlike getText(), this doesn't copy the text
+   * if it's a view into a source buffer.
+   * @sa AtomTable
+   */
+  public: Char const* getTextAtom() const
+  {
+    if (this->textAtom == 0) this->textAtom = ATOM_TABLE->getAtom(this->getTextBuffer(), this->getTextLength());
+    return this->textAtom;
+  }
+
   /// Set the location of the token within the source code.
   public: void setSourceLocation(SourceLocationRecord const &loc)
   {
@@ -183,6 +183,8 @@ Word getSourceLocationRecordCount(SourceLocation const *sl);
 
 // Helpers
 #include "IdGenerator.h"
+#include "AtomTable.h"
+#include "SourceFileTable.h"
 #include "source_location.h"
 
 // Generic Data Interfaces
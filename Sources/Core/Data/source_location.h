@@ -31,8 +31,10 @@ class SourceLocation : public TiObject
  * @ingroup core_data
  *
  * This class holds the location data within the source code of a token or
- * a parsed data object. This includes, the name of the source file, and the
- * line and column within that file at which the token appeared.
+ * a parsed data object. This includes, the id of the source file within
+ * SOURCE_FILE_TABLE, and the line and column within that file at which the
+ * token appeared. Holding a file id rather than the file's name keeps records
+ * small and cheap to copy into every token.
  */
 class SourceLocationRecord : public SourceLocation
 {
@@ -42,10 +44,18 @@ class SourceLocationRecord : public SourceLocation
   TYPE_INFO(SourceLocationRecord, SourceLocation, "Core.Data", "Core", "alusus.org");
 
 
+  //============================================================================
+  // Constants
+
+  /// Records are created for most parsed tokens, so they are allocated from slabs.
+  public: static constexpr Bool SLAB_ALLOCATED = true;
+
+
   //============================================================================
   // Members
 
-  public: SharedPtr<Str> filename;
+  /// The id of the source file within SOURCE_FILE_TABLE, or 0 if unknown.
+  public: Word fileId = 0;
 
   /**
    * @brief The line number within the source file.
@@ -67,13 +77,27 @@ class SourceLocationRecord : public SourceLocation
   {
   }
 
-  public: SourceLocationRecord(SharedPtr<Str> const &fname, Int l, Int c) : filename(fname), line(l), column(c)
+  public: SourceLocationRecord(Word fid, Int l, Int c) : fileId(fid), line(l), column(c)
   {
   }
 
   public: Bool operator==(SourceLocationRecord const &sl) const
   {
-    return this->filename == sl.filename && this->line == sl.line && this->column == sl.column;
+    return this->fileId == sl.fileId && this->line == sl.line && this->column == sl.column;
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  public: void setFilename(Char const *filename)
+  {
+    this->fileId = SOURCE_FILE_TABLE->getFileId(filename);
+  }
+
+  public: Char const* getFilename() const
+  {
+    return SOURCE_FILE_TABLE->getFilename(this->fileId);
   }
 
 }; // class
@@ -25,6 +25,14 @@ Char const *sourceExtensions[] = {
   S(".مصدر")
 };
 
+static Bool hasSourceExtension(Char const *filename)
+{
+  for (Int i = 0; i < sizeof(sourceExtensions) / sizeof(sourceExtensions[0]); ++i) {
+    if (compareStrSuffix(filename, sourceExtensions[i])) return true;
+  }
+  return false;
+}
+
 
 //==============================================================================
 // Constructor
@@ -37,6 +45,7 @@ RootManager::RootManager() : libraryManager(this), processedFiles(true)
   this->exprRootScope->setProdId(ID_GENERATOR->getId("Root"));
 
   this->rootScopeHandler.setRootScope(this->rootScope);
+  this->prelexer.initialize(this->rootScope);
 
   this->noticeSignal.connect(this->noticeSlot);
 
@@ -132,7 +141,10 @@ SharedPtr<TiObject> RootManager::_processFile(Char const *fullPath, Bool allowRe
   // Process the file.
   Processing::Engine engine(this->rootScope);
   this->noticeSignal.relay(engine.noticeSignal);
-  auto result = engine.processFile(fullPath);
+  SharedPtr<TiObject> result;
+  auto source = this->parallelImporting ? this->prelexFile(fullPath) : SharedPtr<Processing::PrelexedSource>();
+  if (source != 0) result = engine.processPrelexedSource(source.get());
+  else result = engine.processFile(fullPath);
 
   // Remove the added path, if any.
   if (!searchPath.empty()) {
@@ -158,12 +170,7 @@ Bool RootManager::tryImportFile(Char const *filename, Str &errorDetails)
   thread_local static std::array<Char,PATH_MAX> resultFilename;
   if (this->findFile(filename, resultFilename)) {
     filename = resultFilename.data();
-    for (Int i = 0; i < sizeof(sourceExtensions) / sizeof(sourceExtensions[0]); ++i) {
-      if (compareStrSuffix(filename, sourceExtensions[i])) {
-        loadSource = true;
-        break;
-      }
-    }
+    loadSource = hasSourceExtension(filename);
   }
 
   if (loadSource) {
@@ -180,13 +187,29 @@ Bool RootManager::tryImportFile(Char const *filename, Str &errorDetails)
     // Load a library.
     LOG(LogLevel::PARSER_MAJOR, S("Importing library: ") << filename);
 
+    // Libraries can extend the grammar, so files being lexed ahead are dropped while the library is
+    // loaded and are scheduled again afterwards to be lexed using the updated grammar.
+    std::vector<Str> prelexedFilenames;
+    this->prelexer.cancel(prelexedFilenames);
+
     PtrWord id = this->getLibraryManager()->load(filename, errorDetails);
 
+    for (auto const &prelexedFilename : prelexedFilenames) {
+      if (!this->prelexer.schedule(prelexedFilename.c_str())) break;
+    }
+
     return id != 0;
   }
 }
 
 
+void RootManager::setParallelImporting(Bool p)
+{
+  this->parallelImporting = p;
+  if (!p) this->prelexer.stop();
+}
+
+
 void RootManager::pushSearchPath(Char const *path)
 {
   if (path == 0 || *path == C('\0')) {
@@ -347,4 +370,44 @@ Bool RootManager::doesFileExist(Char const *filename)
   return (stat (filename, &buffer) == 0);
 }
 
+SharedPtr<Processing::PrelexedSource> RootManager::prelexFile(Char const *fullPath)
+{
+  // Files that weren't found ahead of time, like the main file, are scheduled now and taken right
+  // away, which lexes them on this thread.
+  if (!this->prelexer.schedule(fullPath)) return SharedPtr<Processing::PrelexedSource>();
+  auto source = this->prelexer.take(fullPath);
+  if (source == 0 || !source->isLexed()) return SharedPtr<Processing::PrelexedSource>();
+  this->schedulePrelexedImports(source.get());
+  return source;
+}
+
+
+/**
+ * Look for the standard import command followed by a string literal in the
+ * tokens of the given source and schedule the source files they refer to. The
+ * files are looked up using the current search paths, which at this point
+ * include the directory of the given source, the same way they will be looked
+ * up when the import is executed. Imports that can't be determined from the
+ * tokens alone, or that end up resolving to a different file, are simply
+ * processed without lexing them ahead.
+ */
+void RootManager::schedulePrelexedImports(Processing::PrelexedSource *source)
+{
+  static Word importIds[] = { ID_GENERATOR->getId(S("import")), ID_GENERATOR->getId(S("اشمل")) };
+  static Word stringLiteralId = ID_GENERATOR->getId(S("LexerDefs.StringLiteral"));
+  thread_local static std::array<Char,PATH_MAX> resultFilename;
+
+  auto const &tokens = source->getTokens();
+  for (Word i = 0; i + 1 < tokens.size(); ++i) {
+    auto const &token = tokens[i];
+    if (!token.isKeyword() || (token.getTextId() != importIds[0] && token.getTextId() != importIds[1])) continue;
+    auto const &filenameToken = tokens[i + 1];
+    if (filenameToken.getId() != stringLiteralId || filenameToken.getText().empty()) continue;
+    if (!this->findFile(filenameToken.getText().c_str(), resultFilename)) continue;
+    if (!hasSourceExtension(resultFilename.data())) continue;
+    if (this->processedFiles.findIndex(resultFilename.data()) != -1) continue;
+    if (!this->prelexer.schedule(resultFilename.data())) return;
+  }
+}
+
 } // namespace
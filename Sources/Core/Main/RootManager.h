@@ -54,6 +54,28 @@ class RootManager : public TiObject, public DynamicBinding, public DynamicInterf
 
   private: Int minNoticeSeverityEncountered = -1;
 
+  /// Lexes imported source files ahead of parsing when parallel importing is enabled.
+  private: Processing::Prelexer prelexer;
+
+  private: Bool parallelImporting = false;
+
+  /// Whether extensions may defer executing root statements in non-interactive runs.
+  private: Bool batchedExecution = true;
+
+  /// The optimization level requested for generated code, from 0 to 3.
+  private: Int optimizationLevel = 0;
+
+  /// Whether generated object files should target the host CPU.
+  private: Bool nativeCpu = false;
+
+  private: Bool jitCacheEnabled = true;
+
+  /// The directory of the JIT cache. Libraries use their default directory if empty.
+  private: Str jitCacheDirectory;
+
+  /// The size limit of the JIT cache in megabytes, or 0 to use the libraries' default.
+  private: Word jitCacheSizeLimit = 0;
+
   private: Bool interactive;
   private: Int processArgCount;
   private: Char const *const *processArgs;
@@ -83,6 +105,7 @@ class RootManager : public TiObject, public DynamicBinding, public DynamicInterf
 
   public: virtual ~RootManager()
   {
+    this->prelexer.stop();
     this->libraryManager.unloadAll();
   }
 
@@ -137,6 +160,10 @@ class RootManager : public TiObject, public DynamicBinding, public DynamicInterf
 
   private: virtual Bool doesFileExist(Char const *filename);
 
+  private: SharedPtr<Processing::PrelexedSource> prelexFile(Char const *fullPath);
+
+  private: void schedulePrelexedImports(Processing::PrelexedSource *source);
+
   public: void resetMinNoticeSeverityEncountered()
   {
     this->minNoticeSeverityEncountered = -1;
@@ -157,6 +184,109 @@ class RootManager : public TiObject, public DynamicBinding, public DynamicInterf
     return this->interactive;
   }
 
+  /**
+   * @brief Enable or disable parallel importing.
+   *
+   * When enabled, the source files imported by a file are found as soon as
+   * the file is lexed and are lexed on worker threads while the file is
+   * being parsed. Parsing and the execution of imports still happen on the
+   * calling thread in the original order, so the results and the order of
+   * notices are the same as when importing serially.
+   */
+  public: void setParallelImporting(Bool p);
+
+  public: Bool isParallelImporting() const
+  {
+    return this->parallelImporting;
+  }
+
+  /**
+   * @brief Enable or disable batched execution of root statements.
+   *
+   * When enabled, which is the default, consecutive root statements of a
+   * non-interactive run can be built and executed together rather than one
+   * by one. Execution still happens in the original order and is never
+   * deferred past an import or the end of the source. Interactive runs
+   * always execute each statement as soon as it's parsed.
+   */
+  public: void setBatchedExecution(Bool b)
+  {
+    this->batchedExecution = b;
+  }
+
+  public: Bool isBatchedExecution() const
+  {
+    return this->batchedExecution && !this->interactive;
+  }
+
+  /**
+   * @brief Set the optimization level of generated code.
+   *
+   * Levels range from 0, which is the default and disables optimization, to
+   * 3. The Core doesn't generate code itself; the level is applied by the
+   * libraries that do when they're loaded.
+   */
+  public: void setOptimizationLevel(Int level)
+  {
+    if (level < 0 || level > 3) {
+      throw EXCEPTION(InvalidArgumentException, S("level"), S("Must be between 0 and 3."), level);
+    }
+    this->optimizationLevel = level;
+  }
+
+  public: Int getOptimizationLevel() const
+  {
+    return this->optimizationLevel;
+  }
+
+  /// Set whether generated object files target the host CPU rather than a generic one.
+  public: void setNativeCpu(Bool n)
+  {
+    this->nativeCpu = n;
+  }
+
+  public: Bool isNativeCpu() const
+  {
+    return this->nativeCpu;
+  }
+
+  /**
+   * @brief Enable or disable the JIT cache.
+   *
+   * When enabled, which is the default, libraries that compile code for
+   * execution may keep the compiled code on disk and reuse it in later runs
+   * instead of compiling the same code again.
+   */
+  public: void setJitCacheEnabled(Bool e)
+  {
+    this->jitCacheEnabled = e;
+  }
+
+  public: Bool isJitCacheEnabled() const
+  {
+    return this->jitCacheEnabled;
+  }
+
+  public: void setJitCacheDirectory(Char const *dir)
+  {
+    this->jitCacheDirectory = dir;
+  }
+
+  public: Str const& getJitCacheDirectory() const
+  {
+    return this->jitCacheDirectory;
+  }
+
+  public: void setJitCacheSizeLimit(Word megabytes)
+  {
+    this->jitCacheSizeLimit = megabytes;
+  }
+
+  public: Word getJitCacheSizeLimit() const
+  {
+    return this->jitCacheSizeLimit;
+  }
+
   public: void setProcessArgInfo(Int count, Char const *const *args)
   {
     this->processArgCount = count;
@@ -85,6 +85,18 @@ class RootScopeHandler : public TiObject, public DynamicBinding, public DynamicI
     Core::Processing::Parser *parser, Processing::ParserState *state
   );
 
+  /**
+   * @brief Finish processing root elements that were deferred by extensions.
+   * Called before imports and at the end of every parsed source. The default
+   * implementation doesn't defer anything, so it does nothing.
+   */
+  public: METHOD_BINDING_CACHE(flushPendingElements,
+    void, (Processing::Parser* /* parser */, Processing::ParserState* /* state */)
+  );
+  private: static void _flushPendingElements(TiObject *self,
+    Core::Processing::Parser *parser, Processing::ParserState *state
+  );
+
   /// @}
 
 }; // class
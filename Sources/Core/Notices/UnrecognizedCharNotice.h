@@ -111,7 +111,7 @@ class UnrecognizedCharNotice : public Notice
   public: void appendText(Char ch, Data::SourceLocationRecord const &sl)
   {
     if (this->getSourceLocation() == 0) {
-      this->setSourceLocation(std::make_shared<Data::SourceLocationRecord>(sl));
+      this->setSourceLocation(newSharedObject<Data::SourceLocationRecord>(sl));
     }
     this->text.append(1, ch);
   }
@@ -134,7 +134,7 @@ class UnrecognizedCharNotice : public Notice
   {
     if (str == 0 || str[0] == C('\0')) return;
     if (this->getSourceLocation() == 0) {
-      this->setSourceLocation(std::make_shared<Data::SourceLocationRecord>(sl));
+      this->setSourceLocation(newSharedObject<Data::SourceLocationRecord>(sl));
     }
     this->text.append(str);
   }
@@ -10,6 +10,7 @@
  */
 //==============================================================================
 
+#include <sys/stat.h>
 #include "core.h"
 
 namespace Core { namespace Processing
@@ -28,6 +29,7 @@ void Engine::initialize(SharedPtr<Data::Ast::Scope> const &rootScope)
   this->parser.initialize(rootScope);
   this->noticeSignal.relay(this->parser.noticeSignal);
   this->lexer.tokenGenerated.connect(this->parser.handleNewTokenSlot);
+  this->parser.topLevelProdParsed.connect(this->topLevelProdParsedSlot);
 }
 
 
@@ -42,10 +44,10 @@ SharedPtr<TiObject> Engine::processString(Char const *str, Char const *name)
   // Start passing characters to the lexer.
 
   Data::SourceLocationRecord sourceLocation;
-  sourceLocation.filename = std::make_shared<Str>(name);
+  sourceLocation.setFilename(name);
   sourceLocation.line = 1;
   sourceLocation.column = 1;
-  lexer.handleNewString(str, sourceLocation);
+  lexer.handleNewSpan(str, getStrLen(str), sourceLocation);
 
   auto endLine = sourceLocation.line;
   auto endColumn = sourceLocation.column;
@@ -61,14 +63,95 @@ SharedPtr<TiObject> Engine::processString(Char const *str, Char const *name)
 
 SharedPtr<TiObject> Engine::processFile(Char const *filename)
 {
+  // Regular files are mapped into memory and lexed in place.
+  struct stat fileStat;
+  if (stat(filename, &fileStat) == 0 && S_ISREG(fileStat.st_mode)) {
+    return this->processMappedFile(filename);
+  }
+
   // Open the file.
   std::ifstream fin(filename);
-  StdCharInStream finStream(&fin);
 
   if (fin.fail()) {
     throw EXCEPTION(InvalidArgumentException, S("filename"), S("Could not open file."), filename);
   }
-  return this->processStream(&finStream, filename);
+
+  parser.beginParsing();
+
+  // Pass the file's content to the lexer in blocks to allow the lexer to process runs of characters
+  // in bulk.
+  Data::SourceLocationRecord sourceLocation;
+  sourceLocation.setFilename(filename);
+  sourceLocation.line = 1;
+  sourceLocation.column = 1;
+  Char buffer[ENGINE_FILE_READ_BLOCK_SIZE];
+  while (fin.read(buffer, ENGINE_FILE_READ_BLOCK_SIZE) || fin.gcount() > 0) {
+    lexer.handleNewChars(buffer, fin.gcount(), sourceLocation);
+  }
+
+  auto endLine = sourceLocation.line;
+  auto endColumn = sourceLocation.column;
+
+  lexer.handleNewChar(FILE_TERMINATOR, sourceLocation);
+
+  sourceLocation.line = endLine;
+  sourceLocation.column = endColumn;
+
+  return parser.endParsing(sourceLocation);
+}
+
+
+SharedPtr<TiObject> Engine::processMappedFile(Char const *filename)
+{
+  MappedCharInStream stream(filename);
+
+  parser.beginParsing();
+
+  // Pass the whole content to the lexer at once. The mapping stays alive until parsing is done, so
+  // tokens can refer to their texts within the mapped content.
+  Data::SourceLocationRecord sourceLocation;
+  sourceLocation.setFilename(filename);
+  sourceLocation.line = 1;
+  sourceLocation.column = 1;
+  lexer.handleNewSpan(stream.getBuffer(), stream.getSize(), sourceLocation);
+
+  auto endLine = sourceLocation.line;
+  auto endColumn = sourceLocation.column;
+
+  lexer.handleNewChar(FILE_TERMINATOR, sourceLocation);
+
+  sourceLocation.line = endLine;
+  sourceLocation.column = endColumn;
+
+  return parser.endParsing(sourceLocation);
+}
+
+
+SharedPtr<TiObject> Engine::processPrelexedSource(PrelexedSource *source)
+{
+  if (source == 0 || !source->isLexed()) {
+    throw EXCEPTION(InvalidArgumentException, S("source"), S("Cannot be null or unlexed."));
+  }
+
+  parser.beginParsing();
+
+  // Notices are raised through the lexer so they reach the receivers the same way they do when
+  // lexing during parsing.
+  auto const &tokens = source->getTokens();
+  auto const &notices = source->getNotices();
+  Word noticeIndex = 0;
+  for (Word i = 0; i < tokens.size(); ++i) {
+    while (noticeIndex < notices.size() && notices[noticeIndex].tokenIndex == i) {
+      this->lexer.noticeSignal.emit(notices[noticeIndex++].notice);
+    }
+    this->parser.handleNewToken(&tokens[i]);
+  }
+  while (noticeIndex < notices.size()) {
+    this->lexer.noticeSignal.emit(notices[noticeIndex++].notice);
+  }
+
+  Data::SourceLocationRecord sourceLocation = source->getEndSourceLocation();
+  return parser.endParsing(sourceLocation);
 }
 
 
@@ -83,7 +166,7 @@ SharedPtr<TiObject> Engine::processStream(CharInStreaming *is, Char const *strea
 
   // Start passing characters to the lexer.
   Data::SourceLocationRecord sourceLocation;
-  sourceLocation.filename = std::make_shared<Str>(streamName);
+  sourceLocation.setFilename(streamName);
   sourceLocation.line = 1;
   sourceLocation.column = 1;
   Char c = is->get();
@@ -103,4 +186,174 @@ SharedPtr<TiObject> Engine::processStream(CharInStreaming *is, Char const *strea
   return parser.endParsing(sourceLocation);
 }
 
+
+
+SharedPtr<TiObject> Engine::processEditableString(Char const *str, Char const *name)
+{
+  if (str == 0) {
+    throw EXCEPTION(InvalidArgumentException, S("str"), S("Cannot be null."), str);
+  }
+
+  this->editableSource = str;
+  this->editableSourceFileId = SOURCE_FILE_TABLE->getFileId(name);
+  this->editableSourceProcessed = true;
+  this->statementRecords.clear();
+
+  Data::SourceLocationRecord sourceLocation;
+  sourceLocation.line = 1;
+  sourceLocation.column = 1;
+  auto result = this->processEditableRegion(0, this->editableSource.size(), sourceLocation);
+  this->statementRecords.swap(this->parsedStatementRecords);
+  return result;
+}
+
+
+/**
+ * The region to reparse starts at the last statement starting at or before the
+ * start of the edit and ends before the first statement starting after the end
+ * of the edit. An edit at the very start of a statement can also change where
+ * the statement before it ends, so that statement is included as well. If the
+ * edit is before the first statement, the region starts at the beginning of
+ * the source.
+ */
+SharedPtr<TiObject> Engine::processEdit(Word offset, Word length, Char const *text)
+{
+  if (!this->editableSourceProcessed) {
+    throw EXCEPTION(GenericException, S("No editable source has been processed yet."));
+  }
+  if (text == 0) {
+    throw EXCEPTION(InvalidArgumentException, S("text"), S("Cannot be null."));
+  }
+  if (offset > this->editableSource.size() || length > this->editableSource.size() - offset) {
+    throw EXCEPTION(InvalidArgumentException, S("length"), S("Edited range is out of the source's bounds."), length);
+  }
+
+  // Find the region enclosing the edit.
+  auto &records = this->statementRecords;
+  auto compareOffset = [](Word o, StatementRecord const &record)->Bool { return o < record.offset; };
+  Int first = std::upper_bound(records.begin(), records.end(), offset, compareOffset) - records.begin() - 1;
+  if (first > 0 && records[first].offset == offset) --first;
+  Int last = std::upper_bound(records.begin(), records.end(), offset + length, compareOffset) - records.begin();
+  Data::SourceLocationRecord sourceLocation;
+  Word regionStart;
+  if (first <= 0) {
+    first = 0;
+    regionStart = 0;
+    sourceLocation.line = 1;
+    sourceLocation.column = 1;
+  } else {
+    regionStart = records[first].offset;
+    sourceLocation.line = records[first].line;
+    sourceLocation.column = records[first].column;
+  }
+  Word regionEnd = last < records.size() ? records[last].offset : this->editableSource.size();
+
+  // Remove the elements of the old statements from the root scope, remembering where the first of them was.
+  auto rootScope = this->parser.getRootScope().get();
+  Int spliceIndex = -1;
+  for (Int i = first; i < last; ++i) {
+    Int index = Engine::findElementIndex(rootScope, records[i].data.get());
+    if (index == -1) continue;
+    rootScope->remove(index);
+    if (spliceIndex == -1 || index < spliceIndex) spliceIndex = index;
+  }
+  for (Int i = last; i < records.size() && spliceIndex == -1; ++i) {
+    spliceIndex = Engine::findElementIndex(rootScope, records[i].data.get());
+  }
+  Word elementCount = rootScope->getCount();
+  if (spliceIndex == -1) spliceIndex = elementCount;
+
+  // Apply the edit and reparse the region.
+  this->editableSource.replace(offset, length, text);
+  Word regionSize = regionEnd - regionStart - length + getStrLen(text);
+  Int endLine = last < records.size() ? records[last].line : 0;
+  Int endColumn = last < records.size() ? records[last].column : 0;
+  auto result = this->processEditableRegion(regionStart, regionSize, sourceLocation);
+
+  // Move the new elements to where the old ones were.
+  if (spliceIndex < elementCount) {
+    for (Int i = 0; elementCount + i < rootScope->getCount(); ++i) {
+      auto element = rootScope->get(elementCount + i);
+      rootScope->remove(elementCount + i);
+      rootScope->insert(spliceIndex + i, element);
+    }
+  }
+
+  // Shift the statements following the region, then replace the statements of the region.
+  Int offsetDelta = static_cast<Int>(regionSize) - static_cast<Int>(regionEnd - regionStart);
+  for (Int i = last; i < records.size(); ++i) {
+    if (records[i].line == endLine) records[i].column += sourceLocation.column - endColumn;
+    records[i].line += sourceLocation.line - endLine;
+    records[i].offset += offsetDelta;
+  }
+  records.erase(records.begin() + first, records.begin() + last);
+  records.insert(records.begin() + first, this->parsedStatementRecords.begin(), this->parsedStatementRecords.end());
+
+  return result;
+}
+
+
+/**
+ * Parse a region of the editable source, starting at the given location, and
+ * record the top level statements in it. The location is updated with the
+ * location immediately following the region.
+ */
+SharedPtr<TiObject> Engine::processEditableRegion(
+  Word offset, Word size, Data::SourceLocationRecord &sourceLocation
+) {
+  this->parsedStatementRecords.clear();
+  this->parser.setTopLevelProdTracking(true);
+  this->parser.beginParsing();
+
+  // Pass the region to the lexer at once. The source is not modified until parsing is done, so tokens can refer to
+  // their texts within the source.
+  Char const *region = this->editableSource.c_str() + offset;
+  Int startLine = sourceLocation.line;
+  Int startColumn = sourceLocation.column;
+  sourceLocation.fileId = this->editableSourceFileId;
+  lexer.handleNewSpan(region, size, sourceLocation);
+
+  auto endLine = sourceLocation.line;
+  auto endColumn = sourceLocation.column;
+
+  lexer.handleNewChar(FILE_TERMINATOR, sourceLocation);
+
+  sourceLocation.line = endLine;
+  sourceLocation.column = endColumn;
+
+  auto result = this->parser.endParsing(sourceLocation);
+  this->parser.setTopLevelProdTracking(false);
+
+  // Find the offsets of the statements from their lines and columns.
+  Word i = 0;
+  Int line = startLine;
+  Int column = startColumn;
+  for (auto &record : this->parsedStatementRecords) {
+    while (i < size && (line != record.line || column != record.column)) {
+      computeNextCharPosition(static_cast<WChar>(region[i]), line, column);
+      // Skip the remaining bytes of multi byte characters.
+      do ++i; while (i < size && (region[i] & 0xC0) == 0x80);
+    }
+    record.offset = offset + i;
+  }
+
+  return result;
+}
+
+
+void Engine::onTopLevelProdParsed(Data::SourceLocationRecord const &sourceLocation, SharedPtr<TiObject> const &data)
+{
+  this->parsedStatementRecords.push_back({ 0, sourceLocation.line, sourceLocation.column, data });
+}
+
+
+Int Engine::findElementIndex(Data::Ast::Scope *scope, TiObject *element)
+{
+  if (element == 0) return -1;
+  for (Int i = 0; i < scope->getCount(); ++i) {
+    if (scope->get(i).get() == element) return i;
+  }
+  return -1;
+}
+
 } } // namespace
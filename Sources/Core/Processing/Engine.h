@@ -26,6 +26,19 @@ class Engine : public TiObject
   TYPE_INFO(Engine, TiObject, "Core.Processing", "Core", "alusus.org");
 
 
+  //============================================================================
+  // Types
+
+  /// The position and parsing data of a top level statement in the editable source.
+  private: struct StatementRecord
+  {
+    Word offset;
+    Int line;
+    Int column;
+    SharedPtr<TiObject> data;
+  };
+
+
   //============================================================================
   // Member Variables
 
@@ -33,6 +46,21 @@ class Engine : public TiObject
 
   private: Parser parser;
 
+  /// The source parsed by processEditableString, with all the edits applied so far.
+  private: Str editableSource;
+
+  /// The id of the editable source's name within SOURCE_FILE_TABLE.
+  private: Word editableSourceFileId = 0;
+
+  /// Whether processEditableString was called, which is needed before processing edits.
+  private: Bool editableSourceProcessed = false;
+
+  /// The top level statements of the editable source ordered by their offsets.
+  private: std::vector<StatementRecord> statementRecords;
+
+  /// The top level statements received from the parser during the current parsing.
+  private: std::vector<StatementRecord> parsedStatementRecords;
+
 
   //============================================================================
   // Signals
@@ -41,6 +69,14 @@ class Engine : public TiObject
   public: SignalRelay<void, SharedPtr<Notices::Notice> const&> noticeSignal;
 
 
+  //============================================================================
+  // Slots
+
+  private: Slot<void, Data::SourceLocationRecord const&, SharedPtr<TiObject> const&> topLevelProdParsedSlot = {
+    this, &Engine::onTopLevelProdParsed
+  };
+
+
   //============================================================================
   // Constructors / Destructor
 
@@ -69,9 +105,65 @@ class Engine : public TiObject
   /// Parse the given file and return any resulting parsing data.
   public: SharedPtr<TiObject> processFile(Char const *filename);
 
+  /// Parse the given file by mapping it into memory and return any resulting parsing data.
+  public: SharedPtr<TiObject> processMappedFile(Char const *filename);
+
+  /**
+   * @brief Parse the tokens of a source file that was lexed ahead of time.
+   *
+   * The tokens and the lexer's notices are fed to the parser in their
+   * original order, giving the same results as processing the file directly.
+   * The source must have been lexed using the grammar of this engine's root
+   * scope.
+   */
+  public: SharedPtr<TiObject> processPrelexedSource(PrelexedSource *source);
+
   /// Parse the given stream and return any resulting parsing data.
   public: SharedPtr<TiObject> processStream(CharInStreaming *is, Char const *streamName);
 
+  /**
+   * @brief Parse the given string and keep it for incremental reparsing.
+   *
+   * The string is parsed the same way processString parses it, but the
+   * engine keeps a copy of the string along with the boundaries of its top
+   * level statements so that later edits can be applied using processEdit.
+   */
+  public: SharedPtr<TiObject> processEditableString(Char const *str, Char const *name);
+
+  /**
+   * @brief Apply an edit to the editable source and reparse the affected region.
+   *
+   * The edit replaces the given range of the source with the given text.
+   * Only the smallest run of top level statements enclosing the edit is
+   * relexed and reparsed, and the resulting elements replace the elements of
+   * the old statements in the root scope at the same position. The region is
+   * parsed in isolation, so an edit that leaves a statement unterminated
+   * raises an error at the end of the region instead of consuming the
+   * statements that follow it. The source locations within the statements
+   * following the region are not updated.
+   *
+   * @param offset The offset in bytes of the start of the edited range.
+   * @param length The length in bytes of the edited range.
+   * @param text The text replacing the edited range.
+   * @return Returns the parsing data resulting from parsing the region.
+   */
+  public: SharedPtr<TiObject> processEdit(Word offset, Word length, Char const *text);
+
+  /// Get the editable source with all the edits applied so far.
+  public: Str const& getEditableSource() const
+  {
+    return this->editableSource;
+  }
+
+  private: SharedPtr<TiObject> processEditableRegion(
+    Word offset, Word size, Data::SourceLocationRecord &sourceLocation
+  );
+
+  private: void onTopLevelProdParsed(Data::SourceLocationRecord const &sourceLocation, SharedPtr<TiObject> const &data);
+
+  /// Find the index of the given element within the given scope, or -1 if it's not there.
+  private: static Int findElementIndex(Data::Ast::Scope *scope, TiObject *element);
+
 }; // class
 
 } // namespace
@@ -39,6 +39,9 @@ class ConstTokenizingHandler : public TokenizingHandler
 
   private: Word id;
 
+  /// The interned text ids of const tokens, keyed by the const token definition id.
+  private: std::unordered_map<Word, Word> textIds;
+
 
   //============================================================================
   // Constructor
@@ -56,13 +59,29 @@ class ConstTokenizingHandler : public TokenizingHandler
     return this->id;
   }
 
+  /**
+   * @brief Set the interned text id of the const token with the given definition id.
+   *
+   * Registering the text ids of all const tokens up front means that
+   * preparing tokens never needs to write to this handler or intern text,
+   * which allows lexers on different threads to share this handler.
+   */
+  public: void setTextId(Word defId, Word textId)
+  {
+    this->textIds[defId] = textId;
+  }
+
   public: virtual void prepareToken(Data::Token *token, Word id, WChar const *tokenText, Word tokenTextLength,
                                     Data::SourceLocationRecord const &sourceLocation)
   {
-    token->setText(tokenText, tokenTextLength);
+    if (!token->isTextView()) token->setText(tokenText, tokenTextLength);
     token->setId(this->id);
     token->setSourceLocation(sourceLocation);
     token->setAsKeyword(true);
+    // The text of a const token is determined by its definition, so we only need to intern it once per definition.
+    auto i = this->textIds.find(id);
+    if (i == this->textIds.end()) i = this->textIds.emplace(id, token->getTextId()).first;
+    else token->setTextId(i->second);
   }
 
 }; // class
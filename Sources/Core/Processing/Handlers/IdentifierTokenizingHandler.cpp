@@ -23,12 +23,16 @@ void IdentifierTokenizingHandler::prepareToken(
   Data::Token *token, Word id, WChar const *tokenText, Word tokenTextLength,
   Data::SourceLocationRecord const &sourceLocation
 ) {
-  token->setText(tokenText, tokenTextLength);
+  if (!token->isTextView()) token->setText(tokenText, tokenTextLength);
   token->setId(id);
   token->setSourceLocation(sourceLocation);
-  auto count = this->keywords.count(token->getText().c_str());
-  if (count == 1) token->setAsKeyword(true);
-  else token->setAsKeyword(false);
+  auto i = this->keywords.find(token->getTextAtom());
+  if (i != this->keywords.end()) {
+    token->setAsKeyword(true);
+    token->setTextId(i->second.textId);
+  } else {
+    token->setAsKeyword(false);
+  }
 }
 
 } // namespace
@@ -37,7 +37,15 @@ class IdentifierTokenizingHandler : public TokenizingHandler
   //============================================================================
   // Types
 
-  public: typedef std::unordered_map<Str, Word, std::hash<std::string>> Keywords;
+  /// The reference count of a keyword along with the interned id of its text.
+  public: struct KeywordEntry
+  {
+    Word count;
+    Word textId;
+  };
+
+  /// Keywords are keyed by the atoms of their texts.
+  public: typedef std::unordered_map<Char const*, KeywordEntry> Keywords;
 
 
   //============================================================================
@@ -59,8 +67,10 @@ class IdentifierTokenizingHandler : public TokenizingHandler
 
   public: void addKeyword(Char const *keyword)
   {
-    if (this->keywords.count(keyword) == 0) this->keywords[keyword] = 1;
-    else ++this->keywords[keyword];
+    auto atom = ATOM_TABLE->getAtom(keyword);
+    auto i = this->keywords.find(atom);
+    if (i == this->keywords.end()) this->keywords[atom] = { 1, ID_GENERATOR->getId(keyword) };
+    else ++i->second.count;
   }
 
   public: void addKeywords(const std::initializer_list<Char const*> &keywords)
@@ -70,9 +80,10 @@ class IdentifierTokenizingHandler : public TokenizingHandler
 
   public: void removeKeyword(Char const *keyword)
   {
-    if (this->keywords.count(keyword) == 0) return;
-    --this->keywords[keyword];
-    if (this->keywords[keyword] == 0) this->keywords.erase(keyword);
+    auto i = this->keywords.find(ATOM_TABLE->findAtom(keyword, strlen(keyword)));
+    if (i == this->keywords.end()) return;
+    --i->second.count;
+    if (i->second.count == 0) this->keywords.erase(i);
   }
 
   public: void removeKeywords(const std::initializer_list<Char const*> &keywords)
@@ -23,6 +23,9 @@ using namespace Data;
 
 void ImportParsingHandler::onProdEnd(Parser *parser, ParserState *state)
 {
+  // The imported source may depend on the side effects of the preceding root elements.
+  this->rootManager->getRootScopeHandler()->flushPendingElements(parser, state);
+
   Str filenames;
   Str errorDetails;
   auto result = this->tryImport(
@@ -21,6 +21,20 @@ void RootScopeParsingHandler::onProdStart(Parser *parser, ParserState *state, Da
 }
 
 
+void RootScopeParsingHandler::onProdEnd(Parser *parser, ParserState *state)
+{
+  // We reached the end of the source, so any deferred elements need to be processed now.
+  this->rootScopeHandler->flushPendingElements(parser, state);
+}
+
+
+void RootScopeParsingHandler::onProdCancelling(Parser *parser, ParserState *state)
+{
+  GenericParsingHandler::onProdCancelling(parser, state);
+  this->rootScopeHandler->flushPendingElements(parser, state);
+}
+
+
 void RootScopeParsingHandler::addData(
   SharedPtr<TiObject> const &data, Parser *parser, ParserState *state, Int levelIndex
 ) {
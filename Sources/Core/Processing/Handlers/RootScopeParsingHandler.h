@@ -48,9 +48,9 @@ class RootScopeParsingHandler : public GenericParsingHandler
 
   public: virtual void onProdStart(Parser *parser, ParserState *state, Data::Token const *token);
 
-  public: virtual void onProdEnd(Parser *parser, ParserState *state)
-  {
-  }
+  public: virtual void onProdEnd(Parser *parser, ParserState *state);
+
+  public: virtual void onProdCancelling(Parser *parser, ParserState *state);
 
   protected: virtual void addData(SharedPtr<TiObject> const &data, Parser *parser, ParserState *state, Int levelIndex);
 
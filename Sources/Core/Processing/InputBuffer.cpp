@@ -123,6 +123,55 @@ Bool InputBuffer::push(WChar ch, Data::SourceLocationRecord const &sl, Bool forc
 }
 
 
+/**
+ * Push a run of consecutive ASCII characters into the buffer in one step.
+ * The result is identical to pushing the characters one by one, with the
+ * first character at the given source location and each following
+ * character at the position immediately after its predecessor. The caller
+ * must make sure the run fits in the buffer.
+ *
+ * @param chars The characters to push into the buffer.
+ * @param count The number of characters to push.
+ * @param sl The source location of the first character.
+ * @sa getRunCapacity()
+ */
+void InputBuffer::pushRun(Char const *chars, Word count, Data::SourceLocationRecord const &sl)
+{
+  if (count == 0) return;
+  ASSERT(count <= this->getRunCapacity());
+
+  this->charBuffer.append(chars, chars + count);
+
+  // Either extend the last group or start a new one, depending on whether the first character
+  // is at the expected next position.
+  if (this->charGroups.size() == 0) {
+    CharacterGroup cg;
+    cg.sourceLocation = sl;
+    cg.length = count;
+    this->charGroups.push_back(cg);
+    cg.length = 0;
+    this->charGroups.push_back(cg);
+  } else {
+    ASSERT(this->charGroups.size() >= 2);
+    CharacterGroup *lastCg = &this->charGroups.at(this->charGroups.size()-1);
+    if (sl == lastCg->sourceLocation) {
+      this->charGroups.at(this->charGroups.size()-2).length += count;
+    } else {
+      lastCg->sourceLocation = sl;
+      lastCg->length = count;
+      CharacterGroup cg;
+      cg.sourceLocation = sl;
+      cg.length = 0;
+      this->charGroups.push_back(cg);
+    }
+  }
+
+  // Update the ending character group to have the expected position of the next character.
+  CharacterGroup *endCg = &this->charGroups.at(this->charGroups.size()-1);
+  computeNextCharPosition(chars, count, endCg->sourceLocation.line, endCg->sourceLocation.column);
+}
+
+
 /**
  * Remove a given number of characters from the beginning of the buffer. The
  * operation also handles the required changes in the character groups array.
@@ -131,6 +180,8 @@ Bool InputBuffer::push(WChar ch, Data::SourceLocationRecord const &sl, Bool forc
  */
 void InputBuffer::remove(Int count)
 {
+  this->byteOffset += getUtf8Length(this->charBuffer.c_str(), std::min<Word>(count, this->charBuffer.size()));
+
   // Are we removing all the characters in the buffer?
   if (count >= static_cast<Int>(this->charBuffer.size())) {
     // Wipe the buffer completely.
@@ -195,4 +246,19 @@ Bool InputBuffer::isFull()
   }
 }
 
+/**
+ * Get the number of characters that can be pushed using pushRun without
+ * causing the buffer to become full. A run can create at most one new
+ * character group, so this value is 0 if there is no room for a new group.
+ */
+Word InputBuffer::getRunCapacity()
+{
+  if (this->charBuffer.size() + 1 >= INPUT_BUFFER_MAX_CHARACTERS ||
+      this->charGroups.size() + 1 >= INPUT_BUFFER_MAX_GROUPS-1) {
+    return 0;
+  } else {
+    return INPUT_BUFFER_MAX_CHARACTERS - 1 - this->charBuffer.size();
+  }
+}
+
 } } // namespace
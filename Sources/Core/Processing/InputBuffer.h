@@ -72,6 +72,15 @@ class InputBuffer
    */
   private: std::vector<CharacterGroup> charGroups;
 
+  /**
+   * @brief The utf8 byte offset of the first character in the buffer.
+   *
+   * This value is advanced by the utf8 length of the characters removed from
+   * the buffer, which allows the lexer to locate the text of buffered
+   * characters within a contiguous utf8 source.
+   */
+  private: Word byteOffset = 0;
+
 
   //============================================================================
   // Constructor / Destructor
@@ -94,6 +103,9 @@ class InputBuffer
   /// Push a new character to the end of the buffer.
   public: Bool push(WChar ch, Data::SourceLocationRecord const &sl, Bool force=false);
 
+  /// Push a run of consecutive ASCII characters to the end of the buffer.
+  public: void pushRun(Char const *chars, Word count, Data::SourceLocationRecord const &sl);
+
   /// Remove a group of characters from the beginning of the buffer.
   public: void remove(Int count);
 
@@ -128,9 +140,24 @@ class InputBuffer
     else return this->charGroups.at(0).sourceLocation;
   }
 
+  /// Set the utf8 byte offset of the first character in the buffer.
+  public: void setByteOffset(Word offset)
+  {
+    this->byteOffset = offset;
+  }
+
+  /// Get the utf8 byte offset of the first character in the buffer.
+  public: Word getByteOffset() const
+  {
+    return this->byteOffset;
+  }
+
   /// Get whether the buffer is full or not.
   public: Bool isFull();
 
+  /// Get the number of characters that can be pushed in one run without filling the buffer.
+  public: Word getRunCapacity();
+
   /// @}
 
 }; // class
@@ -10,11 +10,46 @@
  */
 //==============================================================================
 
+#if defined(__AVX2__)
+  #include <immintrin.h>
+#elif defined(__SSE2__)
+  #include <emmintrin.h>
+#endif
 #include "core.h"
 
 namespace Core::Processing
 {
 
+//==============================================================================
+// Local Functions
+
+namespace
+{
+
+/// Get the number of ASCII characters at the beginning of the given buffer.
+Word getAsciiRunLength(Char const *chars, Word count)
+{
+  Word i = 0;
+  #if defined(__AVX2__)
+    for (; i + 32 <= count; i += 32) {
+      auto mask = _mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(chars + i)));
+      if (mask != 0) return i + __builtin_ctz(mask);
+    }
+  #elif defined(__SSE2__)
+    for (; i + 16 <= count; i += 16) {
+      auto mask = _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(chars + i)));
+      if (mask != 0) return i + __builtin_ctz(mask);
+    }
+  #endif
+  for (; i < count; ++i) {
+    if (static_cast<Byte>(chars[i]) >= 128) break;
+  }
+  return i;
+}
+
+} // namespace
+
+
 //==============================================================================
 // Member Functions
 
@@ -93,9 +128,161 @@ void Lexer::handleNewChar(Char inputChar, Data::SourceLocationRecord &sourceLoca
  */
 void Lexer::handleNewString(Char const *inputStr, Data::SourceLocationRecord &sourceLocation)
 {
-  for (Int i = 0; i < static_cast<Int>(strlen(inputStr)); i++) {
-    this->handleNewChar(inputStr[i], sourceLocation);
+  this->handleNewChars(inputStr, strlen(inputStr), sourceLocation);
+}
+
+
+/**
+ * Add a contiguous utf8 source to the input buffer and keep processing until no
+ * more characters are in the input buffer. If the lexer isn't in the middle of
+ * a token, the span is used as the source of token texts; tokens will point to
+ * their text within the span instead of having it converted back from the wide
+ * characters in the input buffer. The span must therefore remain valid until
+ * the input is terminated with FILE_TERMINATOR or the lexer is cleared, and
+ * no other input should be passed to the lexer before that except for the
+ * terminating FILE_TERMINATOR.
+ *
+ * @param chars The utf8 characters of the source.
+ * @param count The number of bytes in the source.
+ * @param sourceLocation The source location of the first character in the
+ *                       span. This will be updated with the new location.
+ */
+void Lexer::handleNewSpan(Char const *chars, Word count, Data::SourceLocationRecord &sourceLocation)
+{
+  if (this->inputBuffer.getCharCount() == 0 && this->tempByteCharCount == 0) {
+    this->sourceSpan = chars;
+    this->sourceSpanSize = count;
+    this->inputBuffer.setByteOffset(0);
+  }
+  this->handleNewChars(chars, count, sourceLocation);
+}
+
+
+/**
+ * Add a block of characters to the input buffer and keep processing until no
+ * more characters are in the input buffer. Runs of ASCII characters skip the
+ * multi byte conversion, and runs of characters that keep the DFA in the same
+ * state are pushed into the buffer in one step. The generated tokens are
+ * identical to those generated by passing the characters one by one to
+ * handleNewChar.
+ *
+ * @param chars The characters to add to the input buffer.
+ * @param count The number of characters.
+ * @param sourceLocation The source location of the first character in the
+ *                       block. This will be updated with the new location.
+ */
+void Lexer::handleNewChars(Char const *chars, Word count, Data::SourceLocationRecord &sourceLocation)
+{
+  Word i = 0;
+  while (i < count) {
+    if (this->tempByteCharCount == 0) {
+      Word asciiEnd = i + getAsciiRunLength(chars + i, count - i);
+      while (i < asciiEnd) {
+        Word runLength = this->processDfaRun(chars + i, asciiEnd - i, sourceLocation);
+        if (runLength > 0) {
+          i += runLength;
+        } else {
+          // ASCII characters don't need conversion.
+          this->pushChar(chars[i], sourceLocation);
+          this->processBuffer();
+          computeNextCharPosition(chars[i], sourceLocation.line, sourceLocation.column);
+          ++i;
+        }
+      }
+      if (i >= count) break;
+    }
+    this->handleNewChar(chars[i], sourceLocation);
+    ++i;
+  }
+}
+
+
+/**
+ * Consume a run of ASCII characters at the beginning of the given buffer if
+ * all of them keep the DFA in its current state and no interpreted state is
+ * still open. The characters are pushed into the input buffer in one step
+ * and the states are updated to what they would have been had the characters
+ * been processed one by one. Runs of a single character are left for the
+ * normal path since their closed state could tie with an existing one.
+ *
+ * @return The number of consumed characters, or 0 if the fast path can't be
+ *         used.
+ */
+Word Lexer::processDfaRun(Char const *chars, Word count, Data::SourceLocationRecord &sourceLocation)
+{
+  if (this->dfaState == -1 || this->currentProcessingIndex == 0) return 0;
+  if (this->currentProcessingIndex != this->inputBuffer.getCharCount()) return 0;
+  if (this->errorBuffer.getTextLength() > 0) return 0;
+  for (Word i = 0; i < this->stateCount; ++i) {
+    if (this->states[i]->getTokenLength() == 0) return 0;
   }
+
+  Word maxCount = std::min(count, this->inputBuffer.getRunCapacity());
+  Word runLength = 0;
+  while (
+    runLength < maxCount && chars[runLength] != FILE_TERMINATOR &&
+    this->dfa->getNextState(this->dfaState, chars[runLength]) == this->dfaState
+  ) {
+    ++runLength;
+  }
+  if (runLength < 2) return 0;
+
+  this->inputBuffer.pushRun(chars, runLength, sourceLocation);
+  computeNextCharPosition(chars, runLength, sourceLocation.line, sourceLocation.column);
+
+  // If the DFA state is accepting then the closed state created for the last character in the run
+  // is longer than any existing closed state, so it's the only one that survives.
+  Int defIndex = this->dfa->getAcceptedDefIndex(this->dfaState);
+  if (defIndex != -1) {
+    for (Word i = 0; i < this->stateCount; ++i) {
+      this->recycledStates[this->recycledStateCount++] = this->states[i];
+    }
+    auto state = this->createState();
+    state->setTokenDefIndex(defIndex);
+    state->setTokenLength(this->currentProcessingIndex + runLength - 1);
+    this->states[0] = state;
+    this->stateCount = 1;
+  }
+  this->currentProcessingIndex += runLength;
+
+  return runLength;
+}
+
+
+/**
+ * Point the text of the last token to the given number of characters at the
+ * beginning of the input buffer within the source span, if a source span is
+ * being lexed.
+ *
+ * @return Returns true if the text view was set, false otherwise, in which case
+ *         any previous text view in the last token is reset.
+ */
+Bool Lexer::setLastTokenTextView(Int length)
+{
+  if (this->sourceSpan != 0) {
+    Word offset = this->inputBuffer.getByteOffset();
+    Word byteLength = getUtf8Length(this->inputBuffer.getChars(), length);
+    if (offset + byteLength <= this->sourceSpanSize) {
+      this->lastToken.setTextView(this->sourceSpan + offset, byteLength);
+      return true;
+    }
+  }
+  this->lastToken.setTextView(0, 0);
+  return false;
+}
+
+
+Bool Lexer::prepareForConcurrentUse()
+{
+  auto lexerModule = static_cast<Core::Data::Grammar::LexerModule*>(this->grammarContext.getModule());
+  if (lexerModule == 0) {
+    throw EXCEPTION(GenericException, S("Lexer is not initialized."));
+  }
+  auto dfa = this->dfaEnabled ? lexerModule->getDfa(&this->grammarContext) : SharedPtr<Data::Grammar::LexerDfa>();
+  if (dfa == 0 || !dfa->isComplete()) return false;
+  this->dfa = dfa;
+  this->concurrent = true;
+  return true;
 }
 
 
@@ -148,6 +335,9 @@ Bool Lexer::pushChar(WChar ch, Data::SourceLocationRecord const &sl)
       if (closedStateCount == 0) {
         // There are no closed states, so replace the last character.
         this->inputBuffer.push(ch, sl, true);
+        // The buffer no longer matches the source span, so token texts can't be taken from it.
+        this->sourceSpan = 0;
+        this->sourceSpanSize = 0;
         this->currentProcessingIndex--;
         this->currentTokenClamped = true;
         return true;
@@ -244,6 +434,7 @@ Int Lexer::process()
     if (this->states[i]->getTokenLength() == 0) openStateCount++;
     else closedStateCount++;
   }
+  if (this->dfaState != -1) openStateCount++;
   if (openStateCount > 0) {
     // If the buffer is full and we have closed states, then we should choose one of them,
     // otherwise, wait until the open states are closed or deleted.
@@ -271,10 +462,13 @@ Int Lexer::process()
         TokenizingHandler *handler = ti_cast<TokenizingHandler>(def->getBuildHandler().get());
         if (handler == 0) {
           this->lastToken.setId(def->getId());
-          this->lastToken.setText(this->inputBuffer.getChars(), this->states[i]->getTokenLength());
+          if (!this->setLastTokenTextView(this->states[i]->getTokenLength())) {
+            this->lastToken.setText(this->inputBuffer.getChars(), this->states[i]->getTokenLength());
+          }
           this->lastToken.setSourceLocation(this->inputBuffer.getSourceLocation());
           this->lastToken.setAsKeyword(false);
         } else {
+          this->setLastTokenTextView(this->states[i]->getTokenLength());
           handler->prepareToken(&this->lastToken, def->getId(), this->inputBuffer.getChars(),
                                 this->states[i]->getTokenLength(), this->inputBuffer.getSourceLocation());
         }
@@ -291,6 +485,7 @@ Int Lexer::process()
         this->recycledStates[this->recycledStateCount++] = this->states[i];
       }
       this->stateCount = 0;
+      this->dfaState = -1;
     } else if (closedStateCount > 0) {
       Int bestToken = this->selectBestToken();
       if (closedStateCount > 1) {
@@ -352,9 +547,12 @@ Int Lexer::process()
       TokenizingHandler *handler = ti_cast<TokenizingHandler>(def->getBuildHandler().get());
       if (handler == 0) {
         this->lastToken.setId(def->getId());
-        this->lastToken.setText(this->inputBuffer.getChars(), this->states[i]->getTokenLength());
+        if (!this->setLastTokenTextView(this->states[i]->getTokenLength())) {
+          this->lastToken.setText(this->inputBuffer.getChars(), this->states[i]->getTokenLength());
+        }
         this->lastToken.setSourceLocation(this->inputBuffer.getSourceLocation());
       } else {
+        this->setLastTokenTextView(this->states[i]->getTokenLength());
         handler->prepareToken(&this->lastToken, def->getId(), this->inputBuffer.getChars(),
                               this->states[i]->getTokenLength(), this->inputBuffer.getSourceLocation());
       }
@@ -413,6 +611,9 @@ Int Lexer::process()
     // There should be no more open states at this point.
     ASSERT(openStateCount == 0);
     this->inputBuffer.clear();
+    // The source span is no longer needed after the last token is emitted.
+    this->sourceSpan = 0;
+    this->sourceSpanSize = 0;
   }
 
   // Check if we need more characters to be added to the input buffer.
@@ -437,8 +638,19 @@ void Lexer::processStartChar(WChar inputChar)
   LOG(LogLevel::LEXER_MID, S("Starting a new token. New char: '") << inputChar << S("'"));
 
   auto lexerModule = static_cast<Core::Data::Grammar::LexerModule*>(this->grammarContext.getModule());
-  auto cache = lexerModule->getCharBasedDecisionCache();
 
+  // Start the DFA for the tokens that can be compiled.
+  if (!this->concurrent) {
+    if (this->dfaEnabled) this->dfa = lexerModule->getDfa(&this->grammarContext);
+    else this->dfa.reset();
+  }
+  if (this->dfa != 0) {
+    this->dfaState = this->dfa->getNextState(this->dfa->getStartState(), inputChar);
+    // No tokens are left for the interpreted path.
+    if (this->dfa->isComplete()) return;
+  }
+
+  auto cache = lexerModule->getCharBasedDecisionCache();
   auto iter = cache->find(inputChar);
   if (iter == cache->end()) {
     for (Word i = 0; i < lexerModule->getCount(); i++) {
@@ -487,9 +699,23 @@ void Lexer::processStartChar(WChar inputChar)
         if (std::find(indexes.begin(), indexes.end(), defIndex) == indexes.end()) indexes.push_back(defIndex);
       }
     }
+    // The cache is shared by all lexers using this module so it needs to include the tokens handled
+    // by the DFA, but we don't need to keep states for those tokens.
+    if (this->dfa != 0) {
+      Word count = 0;
+      for (Int i = 0; i < static_cast<Int>(this->nextStateCount); ++i) {
+        if (this->dfa->isCompiled(this->nextStates[i]->getTokenDefIndex())) {
+          this->recycledStates[this->recycledStateCount++] = this->nextStates[i];
+        } else {
+          this->nextStates[count++] = this->nextStates[i];
+        }
+      }
+      this->nextStateCount = count;
+    }
   } else {
     for (Int j = 0; j < iter->second.size(); j++) {
       auto i = iter->second[j];
+      if (this->dfa != 0 && this->dfa->isCompiled(i)) continue;
       // Skip non tokens and non-root tokens.
       TiObject *obj = lexerModule->getElement(i);
       ASSERT(obj != 0 && obj->isA<Data::Grammar::SymbolDefinition>());
@@ -543,10 +769,23 @@ void Lexer::processStartChar(WChar inputChar)
 void Lexer::processNextChar(WChar inputChar)
 {
   // There must be some states currently in the stack.
-  ASSERT(this->stateCount != 0);
+  ASSERT(this->stateCount != 0 || this->dfaState != -1);
 
   LOG(LogLevel::LEXER_MID, S("Processing new character: '") << inputChar << S("'"));
 
+  // Move the DFA forward. If the DFA has already accepted a token before this character then we'll
+  // represent that token with a closed state, similar to interpreted tokens.
+  if (this->dfaState != -1) {
+    Int defIndex = this->dfa->getAcceptedDefIndex(this->dfaState);
+    if (defIndex != -1) {
+      auto state = this->createState();
+      state->setTokenDefIndex(defIndex);
+      state->setTokenLength(this->currentProcessingIndex);
+      this->nextStates[this->nextStateCount++] = state;
+    }
+    this->dfaState = this->dfa->getNextState(this->dfaState, inputChar);
+  }
+
   while (this->stateCount > 0) {
     auto state = this->states[--this->stateCount];
     if (state->getTokenLength() > 0) {
@@ -685,7 +924,7 @@ Lexer::NextAction Lexer::processCharGroupTerm(LexerState *state, WChar inputChar
       excMsg += S("). The definition formula is not set yet.");
       throw EXCEPTION(GenericException, excMsg.c_str());
     }
-    if (Data::Grammar::matchCharGroup(inputChar, def->getCharGroupUnit().get())) {
+    if (def->getCompiledCharGroup()->match(inputChar)) {
       state->refLevel(currentLevel).posId = 1;
       return CONTINUE_NEW_CHAR;
     } else {
@@ -1029,6 +1268,12 @@ void Lexer::clear()
   this->currentProcessingIndex = 0;
   this->currentTokenClamped = false;
   this->lastToken.setId(UNKNOWN_ID);
+  this->dfa.reset();
+  this->concurrent = false;
+  this->dfaState = -1;
+  this->inputBuffer.setByteOffset(0);
+  this->sourceSpan = 0;
+  this->sourceSpanSize = 0;
 }
 
 
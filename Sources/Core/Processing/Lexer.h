@@ -80,6 +80,47 @@ class Lexer : public TiObject
   private: LexerState **recycledStates = 0;
   private: Word recycledStateCount = 0;
 
+  /**
+   * @brief Whether to use the compiled DFA of the lexer module.
+   *
+   * When enabled, root tokens that can be compiled into a DFA are matched
+   * using the DFA's transition tables, while the remaining tokens are matched
+   * by interpreting the grammar terms. When disabled, all tokens are matched
+   * by interpreting the grammar terms.
+   */
+  private: Bool dfaEnabled = true;
+
+  /// The DFA used for the token currently being matched, if any.
+  private: SharedPtr<Data::Grammar::LexerDfa> dfa;
+
+  /**
+   * @brief Whether the lexer was prepared for use on a thread of its own.
+   *
+   * When set, the DFA fetched by prepareForConcurrentUse is used for all
+   * tokens instead of fetching it from the lexer module for every token.
+   */
+  private: Bool concurrent = false;
+
+  /**
+   * @brief The current state within the DFA.
+   *
+   * This value is -1 if the DFA can't accept any more characters for the
+   * current token. Otherwise the DFA is treated as an open state.
+   */
+  private: Int dfaState = -1;
+
+  /**
+   * @brief The contiguous utf8 source currently being lexed, if any.
+   *
+   * When set, the texts of generated tokens are views into this buffer rather
+   * than copies converted from the wide characters in the input buffer.
+   * @sa handleNewSpan()
+   */
+  private: Char const *sourceSpan = 0;
+
+  /// The size in bytes of sourceSpan.
+  private: Word sourceSpanSize = 0;
+
   /**
    * @brief A temporary buffer used to buffer byte characters for conversion.
    * This buffer is used to buffer the received byte characters when multi
@@ -192,6 +233,37 @@ class Lexer : public TiObject
     this->grammarContext.setModule(0);
   }
 
+  /// Enable or disable matching tokens using the compiled DFA.
+  public: void setDfaEnabled(Bool enabled)
+  {
+    this->dfaEnabled = enabled;
+  }
+
+  public: Bool isDfaEnabled() const
+  {
+    return this->dfaEnabled;
+  }
+
+  /**
+   * @brief Prepare the lexer for lexing on a thread other than the grammar's.
+   *
+   * The lexer module's DFA is fetched once, compiling it if needed, and the
+   * lexer stops accessing the module's caches afterwards. This is only
+   * possible if the DFA handles all root tokens; otherwise the lexer would
+   * still need to interpret grammar terms and update the module's shared
+   * decision cache, so it's left unchanged. This function must be called on
+   * the thread that owns the grammar, and the grammar must not be modified
+   * while the lexer is in use on the other thread.
+   *
+   * @return Returns true if the lexer can be used concurrently.
+   */
+  public: Bool prepareForConcurrentUse();
+
+  public: Bool isConcurrent() const
+  {
+    return this->concurrent;
+  }
+
   /// @}
 
   /// @name Parsing Operations
@@ -203,9 +275,21 @@ class Lexer : public TiObject
   /// Add a string of input characters to the input buffer and process them.
   public: void handleNewString(Char const *inputStr, Data::SourceLocationRecord &sourceLocation);
 
+  /// Add a block of input characters to the input buffer and process them.
+  public: void handleNewChars(Char const *chars, Word count, Data::SourceLocationRecord &sourceLocation);
+
+  /// Add a contiguous source to the input buffer and process it without copying token texts.
+  public: void handleNewSpan(Char const *chars, Word count, Data::SourceLocationRecord &sourceLocation);
+
+  /// Consume a run of characters that keep the DFA in its current state.
+  private: Word processDfaRun(Char const *chars, Word count, Data::SourceLocationRecord &sourceLocation);
+
   /// Process all the characters currently waiting in the input buffer.
   private: void processBuffer();
 
+  /// Set the text of the last token as a view into the source span.
+  private: Bool setLastTokenTextView(Int length);
+
   /// Push a character into the input buffer.
   private: Bool pushChar(WChar ch, Data::SourceLocationRecord const &sl);
 
@@ -0,0 +1,66 @@
+/**
+ * @file Core/Processing/MappedCharInStream.cpp
+ * Contains the implementation of class Core::Processing::MappedCharInStream.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/alusus_license_1_0>.
+ */
+//==============================================================================
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "core.h"
+
+namespace Core::Processing
+{
+
+//==============================================================================
+// Constructors & Destructor
+
+MappedCharInStream::MappedCharInStream(Char const *filename)
+{
+  VALIDATE_NOT_NULL(filename);
+
+  Int fd = open(filename, O_RDONLY);
+  if (fd == -1) {
+    throw EXCEPTION(InvalidArgumentException, S("filename"), S("Could not open file."), filename);
+  }
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) != 0 || !S_ISREG(fileStat.st_mode)) {
+    close(fd);
+    throw EXCEPTION(InvalidArgumentException, S("filename"), S("Not a regular file."), filename);
+  }
+
+  // Empty files can't be mapped.
+  if (fileStat.st_size > 0) {
+    void *mapped = mmap(0, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapped == MAP_FAILED) {
+      close(fd);
+      throw EXCEPTION(InvalidArgumentException, S("filename"), S("Could not map file."), filename);
+    }
+    madvise(mapped, fileStat.st_size, MADV_SEQUENTIAL);
+    this->buffer = static_cast<Char const*>(mapped);
+    this->size = fileStat.st_size;
+  } else {
+    this->buffer = S("");
+    this->size = 0;
+  }
+
+  // The mapping stays valid after the file is closed.
+  close(fd);
+}
+
+
+MappedCharInStream::~MappedCharInStream()
+{
+  if (this->size > 0) {
+    munmap(const_cast<Char*>(this->buffer), this->size);
+  }
+}
+
+} // namespace
@@ -0,0 +1,99 @@
+/**
+ * @file Core/Processing/MappedCharInStream.h
+ * Contains the header of class Core::Processing::MappedCharInStream.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/alusus_license_1_0>.
+ */
+//==============================================================================
+
+#ifndef CORE_PROCESSING_MAPPEDCHARINSTREAM_H
+#define CORE_PROCESSING_MAPPEDCHARINSTREAM_H
+
+namespace Core::Processing
+{
+
+/**
+ * @brief A char input stream reading from a memory mapped file.
+ * @ingroup core_processing
+ *
+ * The whole file is mapped into memory when the stream is created, which
+ * allows the content to be handed to the lexer as a single contiguous buffer
+ * using getBuffer() and getSize() instead of reading it one character at a
+ * time. The mapping is released when the stream is destroyed.
+ */
+class MappedCharInStream : public TiObject, public CharInStreaming
+{
+  //============================================================================
+  // Type Info
+
+  TYPE_INFO(MappedCharInStream, TiObject, "Core.Processing", "Core", "alusus.org", (
+    INHERITANCE_INTERFACES(CharInStreaming)
+  ));
+
+
+  //============================================================================
+  // Member Variables
+
+  /// The mapped content of the file.
+  private: Char const *buffer = 0;
+
+  /// The size of the mapped content.
+  private: Word size = 0;
+
+  /// The position of the next character to read using get().
+  private: Word position = 0;
+
+  /// Whether a read beyond the end of the content was attempted.
+  private: Bool eof = false;
+
+
+  //============================================================================
+  // Constructors & Destructor
+
+  /**
+   * @brief Map the given file into memory.
+   *
+   * Throws an InvalidArgumentException if the file can't be opened or if it
+   * isn't a regular file.
+   */
+  public: MappedCharInStream(Char const *filename);
+
+  public: virtual ~MappedCharInStream();
+
+
+  //============================================================================
+  // Member Functions
+
+  public: virtual Char get()
+  {
+    if (this->position < this->size) return this->buffer[this->position++];
+    this->eof = true;
+    return 0;
+  }
+
+  public: virtual Bool isEof()
+  {
+    return this->eof;
+  }
+
+  /// Get the mapped content of the file.
+  public: Char const* getBuffer() const
+  {
+    return this->buffer;
+  }
+
+  /// Get the size of the mapped content of the file.
+  public: Word getSize() const
+  {
+    return this->size;
+  }
+
+}; // class
+
+} // namespace
+
+#endif
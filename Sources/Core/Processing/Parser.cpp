@@ -163,10 +163,7 @@ SharedPtr<TiObject> Parser::endParsing(Data::SourceLocationRecord &endSourceLoca
         if (!this->getTopParsingHandler(this->state.get())->onErrorToken(this, this->state.get(), 0)) {
           // We don't want to create duplicates of this error message.
           if (!unexpectedEofRaised) {
-            auto sourceLocation = std::make_shared<Data::SourceLocationRecord>();
-            sourceLocation->filename = endSourceLocation.filename;
-            sourceLocation->line = endSourceLocation.line;
-            sourceLocation->column = endSourceLocation.column;
+            auto sourceLocation = newSharedObject<Data::SourceLocationRecord>(endSourceLocation);
             this->state->addNotice(SharedPtr<Notices::Notice>(new Notices::UnexpectedEofNotice(sourceLocation)));
             unexpectedEofRaised = true;
           }
@@ -286,6 +283,12 @@ void Parser::handleNewToken(Data::Token const *token)
     return;
   }
 
+  // The first token received outside of top level productions starts the next one.
+  if (this->topLevelProdTracking && !this->topLevelProdStarted) {
+    this->topLevelProdSourceLocation = token->getSourceLocation();
+    this->topLevelProdStarted = true;
+  }
+
   // Reset the processing status of all states.
   this->state->setPrevProcessingStatus(this->state->getProcessingStatus());
   this->state->setProcessingStatus(ParserProcessingStatus::IN_PROGRESS);
@@ -768,6 +771,8 @@ void Parser::clear()
 {
   this->state.reset();
   this->tempState.reset();
+  this->topLevelProdIndex = -1;
+  this->topLevelProdStarted = false;
 }
 
 
@@ -810,76 +815,59 @@ Int Parser::determineMultiplyRoute(Data::Token const *token, ParserState *state)
     // We can go either in or out, so we'll test.
 
     // Check if we have previously cached the decision.
-    if (token->isKeyword()) {
-      // For keywords we need to check against the text of the token rather than just the category to which the token
-      // belongs.
-      auto i = multiplyTerm->getInnerTextBasedDecisionCache()->find(token->getText());
-      if (i != multiplyTerm->getInnerTextBasedDecisionCache()->end()) {
-        return i->second;
-      }
+    Word decisionKey = Parser::getDecisionKey(token);
+    Int route;
+    if (multiplyTerm->getDecisionTable()->find(decisionKey, route)) {
+      ++this->decisionCacheHitCount;
+      return route;
+    }
+    ++this->decisionCacheMissCount;
+
+    // Check whether the inner route accepts the token, using the FIRST set of the inner term if possible.
+    Bool innerAccepted;
+    Data::Grammar::FirstSet buffer;
+    auto firstSet = this->isFirstSetPredictable(token, state) ?
+      Data::Grammar::getFirstSet(multiplyTerm->getTerm().get(), state->getGrammarContext(), &buffer) : 0;
+    if (firstSet != 0 && firstSet->isDeterminate() && !firstSet->isNullable()) {
+      innerAccepted = this->matchFirstSet(firstSet, token);
     } else {
-      // For non-keyword tokens we can just check against the category since the text doesn't influence the parsing
-      // decision.
-      auto i = multiplyTerm->getInnerIdBasedDecisionCache()->find(token->getId());
-      if (i != multiplyTerm->getInnerIdBasedDecisionCache()->end()) {
-        return i->second;
-      }
+      // Initialize the temp state.
+      this->tempState.reset();
+      this->tempState.setBranchingInfo(state, -1);
+      this->tempState.setParsingDimensionInfo(
+        state->getParsingDimensionIndex(), state->getParsingDimensionStartProdIndex()
+      );
+      // Replace the current state level with a new one.
+      this->tempState.ownTopLevel();
+      this->tempState.setTopTermPosId(1|THIS_PROCESSING_PASS);
+      // Create the deeper level.
+      this->tempState.pushTermLevel(multiplyTerm->getTerm().get());
+      // Test the temp state.
+      ++this->routeTestCount;
+      this->testState(token, &this->tempState);
+      innerAccepted = this->tempState.getProcessingStatus() == ParserProcessingStatus::COMPLETE;
     }
-
-    // Initialize the temp state.
-    this->tempState.reset();
-    this->tempState.setBranchingInfo(state, -1);
-    this->tempState.setParsingDimensionInfo(state->getParsingDimensionIndex(), state->getParsingDimensionStartProdIndex());
-    // Replace the current state level with a new one.
-    this->tempState.ownTopLevel();
-    this->tempState.setTopTermPosId(1|THIS_PROCESSING_PASS);
-    // Create the deeper level.
-    this->tempState.pushTermLevel(multiplyTerm->getTerm().get());
-    // Test the temp state.
-    this->testState(token, &this->tempState);
-    // Store results.
-    if (this->tempState.getProcessingStatus() == ParserProcessingStatus::COMPLETE) {
-      if (token->isKeyword()) {
-        multiplyTerm->getInnerTextBasedDecisionCache()->operator[](token->getText()) = 1;
-      } else {
-        multiplyTerm->getInnerIdBasedDecisionCache()->operator[](token->getId()) = 1;
-      }
-      return 1;
+    if (innerAccepted) {
+      route = 1;
+    } else if (errorSync) {
+      // Test outer route.
+      this->tempState.reset();
+      this->tempState.setBranchingInfo(state, -1);
+      this->tempState.setParsingDimensionInfo(
+        state->getParsingDimensionIndex(), state->getParsingDimensionStartProdIndex()
+      );
+      this->tempState.popLevel();
+      // Test the temp state.
+      ++this->routeTestCount;
+      this->testState(token, &this->tempState);
+      if (this->tempState.getProcessingStatus() == ParserProcessingStatus::COMPLETE) route = 0;
+      else route = -1;
     } else {
-      if (errorSync) {
-        // Test outer route.
-        this->tempState.reset();
-        this->tempState.setBranchingInfo(state, -1);
-        this->tempState.setParsingDimensionInfo(
-          state->getParsingDimensionIndex(), state->getParsingDimensionStartProdIndex()
-        );
-        this->tempState.popLevel();
-        // Test the temp state.
-        this->testState(token, &this->tempState);
-        if (this->tempState.getProcessingStatus() == ParserProcessingStatus::COMPLETE) {
-          if (token->isKeyword()) {
-            multiplyTerm->getInnerTextBasedDecisionCache()->operator[](token->getText()) = 0;
-          } else {
-            multiplyTerm->getInnerIdBasedDecisionCache()->operator[](token->getId()) = 0;
-          }
-          return 0;
-        } else {
-          if (token->isKeyword()) {
-            multiplyTerm->getInnerTextBasedDecisionCache()->operator[](token->getText()) =-1;
-          } else {
-            multiplyTerm->getInnerIdBasedDecisionCache()->operator[](token->getId()) = -1;
-          }
-          return -1;
-        }
-      } else {
-        if (token->isKeyword()) {
-          multiplyTerm->getInnerTextBasedDecisionCache()->operator[](token->getText()) = 0;
-        } else {
-          multiplyTerm->getInnerIdBasedDecisionCache()->operator[](token->getId()) = 0;
-        }
-        return 0;
-      }
+      route = 0;
     }
+    // Store results.
+    multiplyTerm->getDecisionTable()->set(decisionKey, route);
+    return route;
   }
 }
 
@@ -902,23 +890,40 @@ Int Parser::determineAlternateRoute(Data::Token const *token, ParserState *state
   auto alternateTerm = static_cast<Data::Grammar::AlternateTerm*>(state->refTopTermLevel().getTerm());
 
   // Check if we have previously cached the decision.
-  if (token->isKeyword()) {
-    // For keywords we need to check against the text of the token rather than just the category to which the token
-    // beongs.
-    auto i = alternateTerm->getInnerTextBasedDecisionCache()->find(token->getText());
-    if (i != alternateTerm->getInnerTextBasedDecisionCache()->end()) {
-      return i->second;
+  Word decisionKey = Parser::getDecisionKey(token);
+  Int route;
+  if (alternateTerm->getDecisionTable()->find(decisionKey, route)) {
+    ++this->decisionCacheHitCount;
+    return route;
+  }
+  ++this->decisionCacheMissCount;
+
+  route = -1;
+  Word termCount = state->getListTermChildCount();
+
+  // Try to determine the route using the FIRST sets of the routes before resorting to testing the routes. This is
+  // only possible as long as the routes can't be completed without consuming the token, otherwise the decision will
+  // depend on what comes after this term.
+  if (this->isFirstSetPredictable(token, state)) {
+    Bool decided = true;
+    for (Int i = 0; static_cast<Word>(i) < termCount; i++) {
+      Data::Grammar::FirstSet buffer;
+      auto firstSet = Data::Grammar::getFirstSet(state->getListTermChild(i), state->getGrammarContext(), &buffer);
+      if (!firstSet->isDeterminate() || firstSet->isNullable()) {
+        decided = false;
+        break;
+      }
+      if (this->matchFirstSet(firstSet, token)) {
+        route = i;
+        break;
+      }
     }
-  } else {
-    // For non-keyword tokens we can just check against the category since the text doesn't influence the parsing
-    // decision.
-    auto i = alternateTerm->getInnerIdBasedDecisionCache()->find(token->getId());
-    if (i != alternateTerm->getInnerIdBasedDecisionCache()->end()) {
-      return i->second;
+    if (decided) {
+      alternateTerm->getDecisionTable()->set(decisionKey, route);
+      return route;
     }
   }
 
-  Word termCount = state->getListTermChildCount();
   for (Int i = 0; static_cast<Word>(i) < termCount; i++) {
     // Initialize the temp state branching from the current one.
     this->tempState.reset();
@@ -933,23 +938,16 @@ Int Parser::determineAlternateRoute(Data::Token const *token, ParserState *state
     // Create the deeper level.
     this->tempState.pushTermLevel(state->getListTermChild(i));
     // Test the temp state.
+    ++this->routeTestCount;
     this->testState(token, &this->tempState);
-    // Store results.
     if (this->tempState.getProcessingStatus()==ParserProcessingStatus::COMPLETE) {
-      if (token->isKeyword()) {
-        alternateTerm->getInnerTextBasedDecisionCache()->operator[](token->getText()) = i;
-      } else {
-        alternateTerm->getInnerIdBasedDecisionCache()->operator[](token->getId()) = i;
-      }
-      return i;
+      route = i;
+      break;
     }
   }
-  if (token->isKeyword()) {
-    alternateTerm->getInnerTextBasedDecisionCache()->operator[](token->getText()) = -1;
-  } else {
-    alternateTerm->getInnerIdBasedDecisionCache()->operator[](token->getId()) = -1;
-  }
-  return -1;
+  // Store results.
+  alternateTerm->getDecisionTable()->set(decisionKey, route);
+  return route;
 }
 
 
@@ -1444,6 +1442,18 @@ void Parser::pushStateProdLevel(
   state->pushProdLevel(module, prod);
   this->getTopParsingHandler(state)->onProdStart(this, state, token);
   this->processLeadingModifierEntry(state);
+
+  // Productions entered from the production holding the root scope are top level productions, unless they are
+  // parsing dimensions.
+  if (
+    this->topLevelProdTracking && this->topLevelProdIndex == -1 && state == this->state.get() &&
+    state->getParsingDimensionIndex() == -1 && state->getProdLevelCount() > 1
+  ) {
+    Int parentTermStackIndex = state->refProdLevel(-2).getTermStackIndex();
+    if (state->getData(parentTermStackIndex).get() == this->rootScope.get()) {
+      this->topLevelProdIndex = state->getProdLevelCount() - 1;
+    }
+  }
 }
 
 
@@ -1483,8 +1493,15 @@ void Parser::popStateLevel(ParserState *state, Bool success)
   }
   // Grab the level's data before deleting it.
   SharedPtr<TiObject> data = state->getData();
+  Bool topLevelProdDone = this->topLevelProdIndex != -1 && state == this->state.get() &&
+    state->isAtProdRoot() && state->getProdLevelCount() - 1 == this->topLevelProdIndex;
   // Now we can remove that state level.
   state->popLevel();
+  if (topLevelProdDone) {
+    this->topLevelProdIndex = -1;
+    this->topLevelProdStarted = false;
+    this->topLevelProdParsed.emit(this->topLevelProdSourceLocation, success ? data : TioSharedPtr::null);
+  }
   // Did we just pop the program root production?
   if (state->getTermLevelCount() == 1) {
     // We just popped the program root, so we'll assign the data to the pre-root level so it can later on be
@@ -1550,9 +1567,13 @@ Bool Parser::matchToken(Word matchId, TiObject *matchText, Data::Token const *to
   if (matched == true && matchText != 0) {
     if (matchText->isA<TiStr>()) {
       matchStr = static_cast<TiStr*>(matchText);
-      if (matchStr->getStr() != token->getText()) matched = false;
+      Str const &str = matchStr->getStr();
+      if (str.size() != token->getTextLength() || memcmp(str.c_str(), token->getTextBuffer(), str.size()) != 0) {
+        matched = false;
+      }
     } else if (matchText->isA<Data::Grammar::Map>()) {
-      if (static_cast<Data::Grammar::Map*>(matchText)->findIndex(token->getText().c_str()) == -1) matched = false;
+      auto map = static_cast<Data::Grammar::Map*>(matchText);
+      if (map->findIndex(token->getTextBuffer(), token->getTextLength()) == -1) matched = false;
     }
   }
   return matched;
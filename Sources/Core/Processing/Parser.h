@@ -76,6 +76,42 @@ class Parser : public TiObject
 
   private: Bool preCloseCompleteLevels;
 
+  /// The number of route decisions that were found in the decision tables.
+  private: Word decisionCacheHitCount = 0;
+
+  /**
+   * @brief The number of route decisions that had to be computed.
+   *
+   * Once the grammar is warmed up this number should stop growing.
+   */
+  private: Word decisionCacheMissCount = 0;
+
+  /**
+   * @brief The number of times a route was tested on the temp state.
+   *
+   * Decisions that can be made using the FIRST sets of the routes don't need
+   * testing, so this only grows for decisions that depend on what follows
+   * the term, or for grammars that can't be analyzed.
+   */
+  private: Word routeTestCount = 0;
+
+  /// Whether to emit topLevelProdParsed for top level productions.
+  private: Bool topLevelProdTracking = false;
+
+  /// The index of the top level production level being parsed, or -1 if none.
+  private: Int topLevelProdIndex = -1;
+
+  /// Whether the first token of the next top level production was received.
+  private: Bool topLevelProdStarted = false;
+
+  /**
+   * @brief The location of the first token of the top level production.
+   *
+   * This is the first token received after the previous top level production
+   * was done, which means it includes any leading modifiers of the production.
+   */
+  private: Data::SourceLocationRecord topLevelProdSourceLocation;
+
 
   //============================================================================
   // Signals & Slots
@@ -92,6 +128,19 @@ class Parser : public TiObject
      */
   public: Signal<void> parsingCompleted;
 
+  /**
+   * @brief Emitted when the parsing of a top level production is done.
+   *
+   * A top level production is a production entered directly from the
+   * production whose data is the root scope, i.e. a top level statement. The
+   * signal receives the location of the first token of the production and the
+   * production's data, which is null if the production was cancelled due to a
+   * syntax error. The signal is only emitted if top level production tracking
+   * is enabled.
+   * @sa setTopLevelProdTracking()
+   */
+  public: Signal<void, Data::SourceLocationRecord const&, SharedPtr<TiObject> const&> topLevelProdParsed;
+
   public: Slot<void, Data::Token const*> handleNewTokenSlot = {this, &Parser::handleNewToken};
 
 
@@ -143,6 +192,31 @@ class Parser : public TiObject
     return this->preCloseCompleteLevels;
   }
 
+  public: Word getDecisionCacheHitCount() const
+  {
+    return this->decisionCacheHitCount;
+  }
+
+  public: Word getDecisionCacheMissCount() const
+  {
+    return this->decisionCacheMissCount;
+  }
+
+  public: Word getRouteTestCount() const
+  {
+    return this->routeTestCount;
+  }
+
+  public: void setTopLevelProdTracking(Bool t)
+  {
+    this->topLevelProdTracking = t;
+  }
+
+  public: Bool getTopLevelProdTracking() const
+  {
+    return this->topLevelProdTracking;
+  }
+
   /// @}
 
   /// @name Parsing Operations
@@ -197,8 +271,37 @@ class Parser : public TiObject
   /// Compute the list of possible routes to take at an alternative term.
   private: Int determineAlternateRoute(Data::Token const *token, ParserState *state);
 
+  /// Get the key of the given token within the decision tables of terms.
+  private: static Word getDecisionKey(Data::Token const *token)
+  {
+    // For keywords the decision depends on the text of the token rather than just the category to which the token
+    // belongs, while for non-keyword tokens the category is enough.
+    if (token->isKeyword()) return token->getTextId() | Data::Grammar::DecisionTable::KEYWORD_KEY_FLAG;
+    else return token->getId();
+  }
+
   private: Int matchParsingDimensionEntry(Data::Token const *token);
 
+  /**
+   * @brief Check whether routes can be predicted for the given token using FIRST sets.
+   *
+   * A token that enters a parsing dimension is accepted regardless of the
+   * route, so it can't be matched against the FIRST sets of the routes.
+   */
+  private: Bool isFirstSetPredictable(Data::Token const *token, ParserState *state)
+  {
+    return state->getParsingDimensionIndex() != -1 || this->matchParsingDimensionEntry(token) == -1;
+  }
+
+  /// Check whether the given token belongs to the given FIRST set.
+  private: Bool matchFirstSet(Data::Grammar::FirstSet const *firstSet, Data::Token const *token)
+  {
+    for (auto const &entry : firstSet->getEntries()) {
+      if (this->matchToken(entry.tokenId, entry.tokenText, token)) return true;
+    }
+    return false;
+  }
+
   /// Test the route taken by the given state.
   private: void testState(Data::Token const *token, ParserState *state);
 
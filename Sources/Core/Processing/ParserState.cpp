@@ -54,6 +54,7 @@ ParserState::ParserState(Word reservedTermLevelCount, Word reservedProdLevelCoun
   this->dataStack.reserve(reservedTermLevelCount),
   this->termStack.resize(0);
   this->prodStack.resize(0);
+  this->reserveProdBoundStacks(reservedProdLevelCount);
   this->grammarContext.setRoot(rootModule);
   this->grammarContext.setModule(rootModule);
 }
@@ -79,6 +80,7 @@ ParserState::ParserState(
   this->dataStack.reserve(reservedTermLevelCount),
   this->termStack.resize(0);
   this->prodStack.resize(0);
+  this->reserveProdBoundStacks(reservedProdLevelCount);
   this->grammarContext.copyFrom(context);
 }
 
@@ -95,6 +97,7 @@ void ParserState::initialize(
   this->termStack.reserve(reservedTermLevelCount);
   this->dataStack.reserve(reservedTermLevelCount);
   this->prodStack.reserve(reservedProdLevelCount);
+  this->reserveProdBoundStacks(reservedProdLevelCount);
   this->termStack.clear();
   this->dataStack.clear();
   this->prodStack.clear();
@@ -115,6 +118,7 @@ void ParserState::initialize(
   this->termStack.reserve(reservedTermLevelCount);
   this->dataStack.reserve(reservedTermLevelCount);
   this->prodStack.reserve(reservedProdLevelCount);
+  this->reserveProdBoundStacks(reservedProdLevelCount);
   this->termStack.clear();
   this->dataStack.clear();
   this->prodStack.clear();
@@ -123,6 +127,19 @@ void ParserState::initialize(
 }
 
 
+/**
+ * Modifiers and error sync blocks are bound to productions, so their stacks
+ * are reserved with the same count as the production stack to avoid growing
+ * them while parsing.
+ */
+void ParserState::reserveProdBoundStacks(Word reservedProdLevelCount)
+{
+  this->leadingModifierStack.reserve(reservedProdLevelCount);
+  this->trailingModifierStack.reserve(reservedProdLevelCount);
+  this->errorSyncBlockStack.reserve(reservedProdLevelCount);
+}
+
+
 /**
  * Delete all state levels and reset branching information.
  */
@@ -27,6 +27,12 @@ namespace Core::Processing
  * each of which specifies the state at a certain level within the hierarchy.
  * The stack also holds data buffers associated with each level within the
  * hierarchy.
+ *
+ * All stacks are reserved when the state is initialized so pushing levels
+ * doesn't allocate while parsing. A state branched from another state (using
+ * setBranchingInfo) shares the levels of the trunk state below the branching
+ * point instead of copying them, and only copies the top level when it needs
+ * to modify it (see ownTopLevel).
  */
 class ParserState
 {
@@ -163,6 +169,8 @@ class ParserState
   /// Reset the object to an empty state.
   protected: void reset();
 
+  private: void reserveProdBoundStacks(Word reservedProdLevelCount);
+
   /**
    * @brief Set the current processing status of this state object.
    *
@@ -0,0 +1,72 @@
+/**
+ * @file Core/Processing/PrelexedSource.cpp
+ * Contains the implementation of class Core::Processing::PrelexedSource.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/alusus_license_1_0>.
+ */
+//==============================================================================
+
+#include "core.h"
+
+namespace Core::Processing
+{
+
+//==============================================================================
+// Member Functions
+
+Bool PrelexedSource::lex(Lexer *lexer)
+{
+  VALIDATE_NOT_NULL(lexer);
+
+  this->tokens.clear();
+  this->notices.clear();
+  this->lexed = false;
+
+  Slot<void, Data::Token const*> tokenSlot(
+    [=](Data::Token const *token)->void
+    {
+      this->tokens.push_back(*token);
+    }
+  );
+  Slot<void, SharedPtr<Notices::Notice> const&> noticeSlot(
+    [=](SharedPtr<Notices::Notice> const &notice)->void
+    {
+      this->notices.push_back({ static_cast<Word>(this->tokens.size()), notice });
+    }
+  );
+  lexer->tokenGenerated.connect(tokenSlot);
+  lexer->noticeSignal.connect(noticeSlot);
+
+  try {
+    this->stream = std::make_shared<MappedCharInStream>(this->filename.c_str());
+
+    // Lex the file the same way Engine::processMappedFile does.
+    Data::SourceLocationRecord sourceLocation;
+    sourceLocation.setFilename(this->filename.c_str());
+    sourceLocation.line = 1;
+    sourceLocation.column = 1;
+    lexer->handleNewSpan(this->stream->getBuffer(), this->stream->getSize(), sourceLocation);
+
+    auto endLine = sourceLocation.line;
+    auto endColumn = sourceLocation.column;
+
+    lexer->handleNewChar(FILE_TERMINATOR, sourceLocation);
+
+    sourceLocation.line = endLine;
+    sourceLocation.column = endColumn;
+    this->endSourceLocation = sourceLocation;
+    this->lexed = true;
+  } catch (...) {
+    this->tokens.clear();
+    this->notices.clear();
+    this->stream.reset();
+  }
+
+  return this->lexed;
+}
+
+} // namespace
@@ -0,0 +1,124 @@
+/**
+ * @file Core/Processing/PrelexedSource.h
+ * Contains the header of class Core::Processing::PrelexedSource.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/alusus_license_1_0>.
+ */
+//==============================================================================
+
+#ifndef CORE_PROCESSING_PRELEXEDSOURCE_H
+#define CORE_PROCESSING_PRELEXEDSOURCE_H
+
+namespace Core::Processing
+{
+
+/**
+ * @brief The tokens of a source file lexed ahead of parsing.
+ * @ingroup core_processing
+ *
+ * The file is mapped into memory and lexed in full, and the generated tokens
+ * are kept along with the notices raised by the lexer and the positions at
+ * which they were raised. Engine::processPrelexedSource can then feed them to
+ * a parser with the same results as lexing the file during parsing. Token
+ * texts refer to the mapped content, so this object must be kept alive until
+ * parsing is done.
+ *
+ * Lexing doesn't need the thread that owns the grammar if the given lexer
+ * was prepared for concurrent use, which allows files to be lexed on worker
+ * threads.
+ * @sa Prelexer
+ */
+class PrelexedSource : public TiObject
+{
+  //============================================================================
+  // Type Info
+
+  TYPE_INFO(PrelexedSource, TiObject, "Core.Processing", "Core", "alusus.org");
+
+
+  //============================================================================
+  // Types
+
+  /// A notice raised by the lexer and the number of tokens generated before it.
+  public: struct NoticeRecord
+  {
+    Word tokenIndex;
+    SharedPtr<Notices::Notice> notice;
+  };
+
+
+  //============================================================================
+  // Member Variables
+
+  private: Str filename;
+
+  private: SharedPtr<MappedCharInStream> stream;
+
+  /// A deque is used so tokens are never copied around as more tokens are added.
+  private: std::deque<Data::Token> tokens;
+
+  private: std::vector<NoticeRecord> notices;
+
+  /// The location following the last character of the file.
+  private: Data::SourceLocationRecord endSourceLocation;
+
+  /// Whether the whole file was lexed successfully.
+  private: Bool lexed = false;
+
+
+  //============================================================================
+  // Constructor
+
+  public: PrelexedSource(Char const *filename) : filename(filename)
+  {
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  /**
+   * @brief Map the file into memory and lex it using the given lexer.
+   *
+   * Errors that prevent lexing the file, like failing to open it, are not
+   * reported; the source is left unlexed instead so the file can be processed
+   * normally to get the errors raised in their proper place.
+   *
+   * @return Returns true if the file was lexed successfully.
+   */
+  public: Bool lex(Lexer *lexer);
+
+  public: Str const& getFilename() const
+  {
+    return this->filename;
+  }
+
+  public: Bool isLexed() const
+  {
+    return this->lexed;
+  }
+
+  public: std::deque<Data::Token> const& getTokens() const
+  {
+    return this->tokens;
+  }
+
+  public: std::vector<NoticeRecord> const& getNotices() const
+  {
+    return this->notices;
+  }
+
+  public: Data::SourceLocationRecord const& getEndSourceLocation() const
+  {
+    return this->endSourceLocation;
+  }
+
+}; // class
+
+} // namespace
+
+#endif
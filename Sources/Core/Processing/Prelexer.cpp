@@ -0,0 +1,149 @@
+/**
+ * @file Core/Processing/Prelexer.cpp
+ * Contains the implementation of class Core::Processing::Prelexer.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/alusus_license_1_0>.
+ */
+//==============================================================================
+
+#include "core.h"
+
+namespace Core::Processing
+{
+
+//==============================================================================
+// Member Functions
+
+void Prelexer::initialize(SharedPtr<Data::Ast::Scope> const &rootScope, Word workerCount)
+{
+  this->stop();
+  this->rootScope = rootScope;
+  if (workerCount == 0) {
+    workerCount = std::thread::hardware_concurrency();
+    if (workerCount == 0) workerCount = 1;
+    else if (workerCount > PRELEXER_MAX_WORKER_COUNT) workerCount = PRELEXER_MAX_WORKER_COUNT;
+  }
+  this->workerCount = workerCount;
+}
+
+
+Bool Prelexer::schedule(Char const *filename)
+{
+  VALIDATE_NOT_NULL(filename);
+  if (this->rootScope == 0) {
+    throw EXCEPTION(GenericException, S("Prelexer is not initialized."));
+  }
+
+  if (this->isScheduled(filename)) return true;
+
+  // The lexer is prepared on this thread since preparing it reads the grammar and can compile the DFA.
+  auto lexer = std::make_shared<Lexer>();
+  lexer->initialize(this->rootScope);
+  if (!lexer->prepareForConcurrentUse()) return false;
+
+  auto job = std::make_shared<Job>();
+  job->source = std::make_shared<PrelexedSource>(filename);
+  job->lexer = lexer;
+  job->done = false;
+
+  if (this->workers.empty()) this->startWorkers();
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->jobs[job->source->getFilename()] = job;
+    this->queue.push_back(job);
+  }
+  this->queueCondition.notify_one();
+  return true;
+}
+
+
+Bool Prelexer::isScheduled(Char const *filename)
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  return this->jobs.find(Str(filename)) != this->jobs.end();
+}
+
+
+SharedPtr<PrelexedSource> Prelexer::take(Char const *filename)
+{
+  std::unique_lock<std::mutex> lock(this->mutex);
+  auto iter = this->jobs.find(Str(filename));
+  if (iter == this->jobs.end()) return SharedPtr<PrelexedSource>();
+  auto job = iter->second;
+  this->jobs.erase(iter);
+
+  // Lex the file on this thread if no worker picked it up yet rather than waiting for one.
+  auto queueIter = std::find(this->queue.begin(), this->queue.end(), job);
+  if (queueIter != this->queue.end()) {
+    this->queue.erase(queueIter);
+    lock.unlock();
+    job->source->lex(job->lexer.get());
+    return job->source;
+  }
+
+  this->doneCondition.wait(lock, [&job] { return job->done; });
+  return job->source;
+}
+
+
+void Prelexer::cancel(std::vector<Str> &filenames)
+{
+  std::unique_lock<std::mutex> lock(this->mutex);
+  for (auto const &pair : this->jobs) filenames.push_back(pair.first);
+  this->jobs.clear();
+  this->queue.clear();
+  this->doneCondition.wait(lock, [this] { return this->runningJobCount == 0; });
+}
+
+
+void Prelexer::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->jobs.clear();
+    this->queue.clear();
+    this->exiting = true;
+  }
+  this->queueCondition.notify_all();
+  for (auto &worker : this->workers) worker.join();
+  this->workers.clear();
+  this->exiting = false;
+}
+
+
+void Prelexer::startWorkers()
+{
+  for (Word i = 0; i < this->workerCount; ++i) {
+    this->workers.emplace_back(&Prelexer::work, this);
+  }
+}
+
+
+void Prelexer::work()
+{
+  std::unique_lock<std::mutex> lock(this->mutex);
+  while (true) {
+    this->queueCondition.wait(lock, [this] { return this->exiting || !this->queue.empty(); });
+    if (this->exiting) return;
+
+    auto job = this->queue.front();
+    this->queue.pop_front();
+    ++this->runningJobCount;
+    lock.unlock();
+
+    job->source->lex(job->lexer.get());
+    // Free the lexer's buffers as soon as they are no longer needed.
+    job->lexer.reset();
+
+    lock.lock();
+    job->done = true;
+    --this->runningJobCount;
+    this->doneCondition.notify_all();
+  }
+}
+
+} // namespace
@@ -0,0 +1,151 @@
+/**
+ * @file Core/Processing/Prelexer.h
+ * Contains the header of class Core::Processing::Prelexer.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/alusus_license_1_0>.
+ */
+//==============================================================================
+
+#ifndef CORE_PROCESSING_PRELEXER_H
+#define CORE_PROCESSING_PRELEXER_H
+
+namespace Core::Processing
+{
+
+/**
+ * @brief Lexes source files ahead of parsing on a pool of worker threads.
+ * @ingroup core_processing
+ *
+ * Files are scheduled by name on the thread that owns the grammar, which also
+ * creates a lexer for each file and prepares it for concurrent use. The files
+ * are then lexed into PrelexedSource objects on the worker threads while the
+ * owning thread is busy with other work, and the owning thread later takes the
+ * results by file name, waiting for the lexing to finish if needed. Parsing
+ * isn't done on the workers since parsing handlers modify the root scope and
+ * the parser updates caches within the grammar.
+ *
+ * The worker lexers read the grammar, so the grammar must not be modified
+ * while jobs are scheduled. Use cancel() before modifying the grammar and
+ * reschedule the cancelled files afterwards. Worker threads are started on
+ * the first scheduled file and are stopped by stop() or on destruction.
+ */
+class Prelexer
+{
+  //============================================================================
+  // Types
+
+  /// A scheduled file and the lexer prepared for it.
+  private: struct Job
+  {
+    SharedPtr<PrelexedSource> source;
+    SharedPtr<Lexer> lexer;
+    Bool done;
+  };
+
+
+  //============================================================================
+  // Member Variables
+
+  private: SharedPtr<Data::Ast::Scope> rootScope;
+
+  private: Word workerCount = 0;
+
+  private: std::vector<std::thread> workers;
+
+  /// Guards all the job related variables below.
+  private: std::mutex mutex;
+
+  /// Signaled when jobs are queued or when the workers need to exit.
+  private: std::condition_variable queueCondition;
+
+  /// Signaled when a job is done.
+  private: std::condition_variable doneCondition;
+
+  /// Jobs waiting for a worker, in scheduling order.
+  private: std::deque<SharedPtr<Job>> queue;
+
+  /// All the jobs that weren't taken yet, keyed by file name.
+  private: std::unordered_map<Str, SharedPtr<Job>, std::hash<std::string>> jobs;
+
+  /// The number of jobs currently being lexed by the workers.
+  private: Word runningJobCount = 0;
+
+  private: Bool exiting = false;
+
+
+  //============================================================================
+  // Constructors / Destructor
+
+  public: Prelexer()
+  {
+  }
+
+  public: ~Prelexer()
+  {
+    this->stop();
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  /**
+   * @brief Set the root scope whose grammar is used to lex the files.
+   *
+   * @param workerCount The number of worker threads. If 0, the number is
+   *                    determined from the hardware's concurrency, up to
+   *                    PRELEXER_MAX_WORKER_COUNT.
+   */
+  public: void initialize(SharedPtr<Data::Ast::Scope> const &rootScope, Word workerCount = 0);
+
+  /**
+   * @brief Schedule the given file for lexing.
+   *
+   * Scheduling a file that's already scheduled and not yet taken does
+   * nothing.
+   *
+   * @return Returns false if the grammar can't be used by concurrent lexers,
+   *         in which case files need to be lexed during parsing.
+   */
+  public: Bool schedule(Char const *filename);
+
+  /// Check whether the given file is scheduled and not yet taken.
+  public: Bool isScheduled(Char const *filename);
+
+  /**
+   * @brief Take the result of lexing the given file.
+   *
+   * Waits for the lexing to finish if the file is still queued or being
+   * lexed. The file is no longer scheduled afterwards.
+   *
+   * @return Returns the lexed source, or null if the file wasn't scheduled.
+   */
+  public: SharedPtr<PrelexedSource> take(Char const *filename);
+
+  /**
+   * @brief Drop all the scheduled files.
+   *
+   * Waits for the files currently being lexed to finish before returning, so
+   * the grammar can be modified safely afterwards.
+   *
+   * @param filenames Receives the names of the dropped files so that they
+   *                  can be rescheduled.
+   */
+  public: void cancel(std::vector<Str> &filenames);
+
+  /// Drop all the scheduled files and stop the worker threads.
+  public: void stop();
+
+  private: void startWorkers();
+
+  private: void work();
+
+}; // class
+
+} // namespace
+
+#endif
@@ -50,7 +50,10 @@ class TokenizingHandler : public Data::Grammar::BuildHandler
    *
    * This event is raised by the lexer when a token is found. The handler should
    * set the properties of the provided Token object which will then be sent to
-   * the parser.
+   * the parser. If the lexer is working on a contiguous source, the token's
+   * text will already be set as a view into that source, in which case
+   * handlers that don't alter the text can leave it as is instead of setting
+   * it from tokenText.
    *
    * @param token The token whose properties should be set by the handler.
    * @param id The id of the token definition associated with the found token.
@@ -27,4 +27,22 @@ void computeNextCharPosition(WChar ch, Int &line, Int &column)
   }
 }
 
+
+void computeNextCharPosition(Char const *chars, Word count, Int &line, Int &column)
+{
+  Int lastBreak = -1;
+  Int newLineCount = 0;
+  for (Word i = 0; i < count; ++i) {
+    if (chars[i] == C('\n')) {
+      ++newLineCount;
+      lastBreak = i;
+    } else if (chars[i] == C('\r')) {
+      lastBreak = i;
+    }
+  }
+  line += newLineCount;
+  if (lastBreak == -1) column += count;
+  else column = count - lastBreak;
+}
+
 } } // namespace
@@ -83,6 +83,23 @@ namespace Core::Processing
  */
 #define LEXER_ERROR_BUFFER_MAX_CHARACTERS 80
 
+/**
+ * @brief The size of the blocks in which source files are read.
+ * @ingroup core_processing
+ *
+ * Files are read and passed to the lexer in blocks of this size.
+ */
+#define ENGINE_FILE_READ_BLOCK_SIZE 16384
+
+/**
+ * @brief The maximum number of worker threads used to lex files ahead of parsing.
+ * @ingroup core_processing
+ *
+ * The number of workers is determined by the hardware's concurrency but will
+ * not exceed this number.
+ */
+#define PRELEXER_MAX_WORKER_COUNT 4
+
 /**
  * @brief Compute the next position based on the given character.
  * @ingroup core_processing
@@ -102,6 +119,23 @@ namespace Core::Processing
  */
 void computeNextCharPosition(WChar ch, Int &line, Int &column);
 
+/**
+ * @brief Compute the position following a run of ASCII characters.
+ * @ingroup core_processing
+ *
+ * This function gives the same result as calling computeNextCharPosition on
+ * each of the given characters in order, but it computes the new line and
+ * column in one pass.
+ *
+ * @param chars The characters used to determine the next position.
+ * @param count The number of characters.
+ * @param line A reference to the value of the current line number. This
+ *             value will be replaced with the new line number value.
+ * @param column A reference to the value of the current column. This value
+ *               will be replaced with the new column value.
+ */
+void computeNextCharPosition(Char const *chars, Word count, Int &line, Int &column);
+
 
 //==============================================================================
 // Parser Definitions
@@ -244,8 +278,13 @@ s_enum(ParsingFlags,
 // Streams
 #include "CharInStreaming.h"
 #include "StdCharInStream.h"
+#include "MappedCharInStream.h"
 #include "InteractiveCharInStream.h"
 
+// Lexing Ahead of Parsing
+#include "PrelexedSource.h"
+#include "Prelexer.h"
+
 // Main Class
 #include "Engine.h"
 
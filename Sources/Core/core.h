@@ -28,6 +28,13 @@
 #include <type_traits>
 #include <atomic>
 #include <functional>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_set>
 #include <limits.h>
 
 // Include global storage functions.
@@ -40,6 +40,24 @@ Str getSystemLanguage()
 }
 
 
+/**
+ * @brief Parse an optimization level option like -O2.
+ * @ingroup main
+ * @return Returns true if the argument is the given prefix followed by a
+ *         single digit from 0 to 3, in which case the level is set to that
+ *         digit.
+ */
+Bool parseOptimizationLevel(Char const *arg, Char const *prefix, Int &level)
+{
+  auto prefixLen = getStrLen(prefix);
+  if (strncmp(arg, prefix, prefixLen) != 0) return false;
+  Char digit = arg[prefixLen];
+  if (digit < C('0') || digit > C('3') || arg[prefixLen + 1] != 0) return false;
+  level = digit - C('0');
+  return true;
+}
+
+
 /**
  * @brief The entry point of the program.
  * @ingroup main
@@ -52,6 +70,14 @@ int main(int argCount, char * const args[])
   Bool interactive = false;
   Char const *sourceFile = 0;
   Bool dump = false;
+  Bool parallelImports = false;
+  Bool lookupCache = true;
+  Bool batchedExecution = true;
+  Int optimizationLevel = 0;
+  Bool nativeCpu = false;
+  Bool jitCache = true;
+  Char const *jitCacheDir = 0;
+  Word jitCacheLimit = 0;
   auto lang = getSystemLanguage();
   if (argCount < 2) help = true;
   for (Int i = 1; i < argCount; ++i) {
@@ -63,6 +89,24 @@ int main(int argCount, char * const args[])
     else if (strcmp(args[i], S("-ت")) == 0) interactive = true;
     else if (strcmp(args[i], S("--dump")) == 0) dump = true;
     else if (strcmp(args[i], S("--إلقاء")) == 0) dump = true;
+    else if (strcmp(args[i], S("--parallel-imports")) == 0) parallelImports = true;
+    else if (strcmp(args[i], S("--اشمل-بالتوازي")) == 0) parallelImports = true;
+    else if (strcmp(args[i], S("--no-lookup-cache")) == 0) lookupCache = false;
+    else if (strcmp(args[i], S("--بلا-ذاكرة-البحث")) == 0) lookupCache = false;
+    else if (strcmp(args[i], S("--no-batched-execution")) == 0) batchedExecution = false;
+    else if (strcmp(args[i], S("--بلا-تنفيذ-مجمع")) == 0) batchedExecution = false;
+    else if (parseOptimizationLevel(args[i], S("-O"), optimizationLevel)) continue;
+    else if (parseOptimizationLevel(args[i], S("-م"), optimizationLevel)) continue;
+    else if (strcmp(args[i], S("--native-cpu")) == 0) nativeCpu = true;
+    else if (strcmp(args[i], S("--معالج-محلي")) == 0) nativeCpu = true;
+    else if (strcmp(args[i], S("--no-jit-cache")) == 0) jitCache = false;
+    else if (strcmp(args[i], S("--بلا-ذاكرة-الترجمة")) == 0) jitCache = false;
+    else if (strcmp(args[i], S("--jit-cache-dir")) == 0 || strcmp(args[i], S("--مجلد-ذاكرة-الترجمة")) == 0) {
+      if (i < argCount-1) jitCacheDir = args[++i];
+    }
+    else if (strcmp(args[i], S("--jit-cache-limit")) == 0 || strcmp(args[i], S("--حد-ذاكرة-الترجمة")) == 0) {
+      if (i < argCount-1) jitCacheLimit = atoi(args[++i]);
+    }
 #ifdef USE_LOGS
     // Parse the log option.
     else if (strcmp(args[i], S("--log")) == 0 || strcmp(args[i], S("--تدوين")) == 0) {
@@ -118,6 +162,30 @@ int main(int argCount, char * const args[])
       outStream << S("\tالقاء شجرة AST عند الانتهاء:\n");
       outStream << S("\t\t--شجرة\n");
       outStream << S("\t\t--dump\n");
+      outStream << S("\tتحليل الملفات المشمولة مسبقاً على التوازي:\n");
+      outStream << S("\t\t--اشمل-بالتوازي\n");
+      outStream << S("\t\t--parallel-imports\n");
+      outStream << S("\tتعطيل الذاكرة المؤقتة لنتائج البحث عن التعريفات:\n");
+      outStream << S("\t\t--بلا-ذاكرة-البحث\n");
+      outStream << S("\t\t--no-lookup-cache\n");
+      outStream << S("\tتنفيذ الجمل العليا واحدة تلو الأخرى بدل تجميعها:\n");
+      outStream << S("\t\t--بلا-تنفيذ-مجمع\n");
+      outStream << S("\t\t--no-batched-execution\n");
+      outStream << S("\tتحديد مستوى تحسين الشفرة المولدة من 0 إلى 3:\n");
+      outStream << S("\t\t-م0 -م1 -م2 -م3\n");
+      outStream << S("\t\t-O0 -O1 -O2 -O3\n");
+      outStream << S("\tاستهداف معالج الجهاز الحالي عند إنشاء الملفات التنفيذية:\n");
+      outStream << S("\t\t--معالج-محلي\n");
+      outStream << S("\t\t--native-cpu\n");
+      outStream << S("\tتعطيل حفظ الشفرة المترجمة على القرص لإعادة استخدامها:\n");
+      outStream << S("\t\t--بلا-ذاكرة-الترجمة\n");
+      outStream << S("\t\t--no-jit-cache\n");
+      outStream << S("\tتحديد مجلد الشفرة المترجمة المحفوظة:\n");
+      outStream << S("\t\t--مجلد-ذاكرة-الترجمة <المجلد>\n");
+      outStream << S("\t\t--jit-cache-dir <dir>\n");
+      outStream << S("\tتحديد الحجم الأقصى للشفرة المترجمة المحفوظة بالميغابايت:\n");
+      outStream << S("\t\t--حد-ذاكرة-الترجمة <الحجم>\n");
+      outStream << S("\t\t--jit-cache-limit <size>\n");
       #if defined(USE_LOGS)
         outStream << S("\tالتحكم بمستوى التدوين (قيمة من 6 بتات):\n");
         outStream << S("\t\t--تدوين\n");
@@ -138,6 +206,14 @@ int main(int argCount, char * const args[])
       outStream << S("\nOptions:\n");
       outStream << S("\t--interactive, -i  Run in interactive mode.\n");
       outStream << S("\t--dump  Tells the Core to dump the resulting AST tree.\n");
+      outStream << S("\t--parallel-imports  Lex imported source files ahead of parsing on worker threads.\n");
+      outStream << S("\t--no-lookup-cache  Disable caching the results of definition lookups, for debugging.\n");
+      outStream << S("\t--no-batched-execution  Build and execute root statements one at a time instead of in batches.\n");
+      outStream << S("\t-O0, -O1, -O2, -O3  Set the optimization level of generated code. Defaults to 0.\n");
+      outStream << S("\t--native-cpu  Build executables for the CPU of this machine rather than a generic CPU.\n");
+      outStream << S("\t--no-jit-cache  Don't reuse or store JIT compiled code on disk.\n");
+      outStream << S("\t--jit-cache-dir <dir>  Set the directory of the JIT cache. Defaults to ~/.cache/alusus.\n");
+      outStream << S("\t--jit-cache-limit <size>  Set the size limit of the JIT cache in megabytes.\n");
       #if defined(USE_LOGS)
         outStream << S("\t--log  A 6 bit value to control the level of details of the log.\n");
       #endif
@@ -157,6 +233,13 @@ int main(int argCount, char * const args[])
       // Prepare the root object;
       Main::RootManager root;
       root.setInteractive(true);
+      root.setParallelImporting(parallelImports);
+      root.setOptimizationLevel(optimizationLevel);
+      root.setNativeCpu(nativeCpu);
+      root.setJitCacheEnabled(jitCache);
+      if (jitCacheDir != 0) root.setJitCacheDirectory(jitCacheDir);
+      root.setJitCacheSizeLimit(jitCacheLimit);
+      root.getSeeker()->setCacheEnabled(lookupCache);
       root.setProcessArgInfo(argCount, args);
       root.setLanguage(lang.c_str());
       Slot<void, SharedPtr<Notices::Notice> const&> noticeSlot(
@@ -182,6 +265,14 @@ int main(int argCount, char * const args[])
     try {
       // Prepare the root object;
       Main::RootManager root;
+      root.setParallelImporting(parallelImports);
+      root.setBatchedExecution(batchedExecution);
+      root.setOptimizationLevel(optimizationLevel);
+      root.setNativeCpu(nativeCpu);
+      root.setJitCacheEnabled(jitCache);
+      if (jitCacheDir != 0) root.setJitCacheDirectory(jitCacheDir);
+      root.setJitCacheSizeLimit(jitCacheLimit);
+      root.getSeeker()->setCacheEnabled(lookupCache);
       root.setProcessArgInfo(argCount, args);
       root.setLanguage(lang.c_str());
       Slot<void, SharedPtr<Notices::Notice> const&> noticeSlot(
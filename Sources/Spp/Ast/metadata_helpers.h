@@ -24,13 +24,20 @@ constexpr Char const* META_EXTRA_AST_TYPE = S("astType");
 //==============================================================================
 // Global Functions
 
+/// Get the extra slot id of META_EXTRA_AST_TYPE.
+inline Word getAstTypeExtraSlot()
+{
+  static Word slot = Core::Data::Ast::MetaExtras::getSlot(META_EXTRA_AST_TYPE);
+  return slot;
+}
+
 // tryGetAstType
 
 template <class OT,
           typename std::enable_if<std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
 inline Type* tryGetAstType(OT *object)
 {
-  auto box = object->getExtra(META_EXTRA_AST_TYPE).template ti_cast_get<Box<WeakPtr<Type>>>();
+  auto box = object->getExtra(getAstTypeExtraSlot()).template ti_cast_get<Box<WeakPtr<Type>>>();
   if (box == 0) return 0;
   else return box->get().lock().get();
 }
@@ -41,7 +48,7 @@ inline Type* tryGetAstType(OT *object)
 {
   auto metadata = ti_cast<Core::Data::Ast::MetaHaving>(object);
   if (metadata == 0) return 0;
-  auto box = metadata->getExtra(META_EXTRA_AST_TYPE).template ti_cast_get<Box<WeakPtr<Type>>>();
+  auto box = metadata->getExtra(getAstTypeExtraSlot()).template ti_cast_get<Box<WeakPtr<Type>>>();
   if (box == 0) return 0;
   else return box->get().lock().get();
 }
@@ -64,7 +71,7 @@ template <class OT,
           typename std::enable_if<std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
 inline void setAstType(OT *object, SharedPtr<Type> const &type)
 {
-  object->setExtra(META_EXTRA_AST_TYPE, Box<WeakPtr<Type>>::create(WeakPtr<Type>(type)));
+  object->setExtra(getAstTypeExtraSlot(), Box<WeakPtr<Type>>::create(WeakPtr<Type>(type)));
 }
 
 template <class OT,
@@ -75,14 +82,14 @@ inline void setAstType(OT *object, SharedPtr<Type> const &type)
   if (metadata == 0) {
     throw EXCEPTION(InvalidArgumentException, S("object"), S("Object does not implement the MetaHaving interface."));
   }
-  metadata->setExtra(META_EXTRA_AST_TYPE, Box<WeakPtr<Type>>::create(WeakPtr<Type>(type)));
+  metadata->setExtra(getAstTypeExtraSlot(), Box<WeakPtr<Type>>::create(WeakPtr<Type>(type)));
 }
 
 template <class OT,
           typename std::enable_if<std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
 inline void setAstType(OT *object, Type *type)
 {
-  object->setExtra(META_EXTRA_AST_TYPE, Box<WeakPtr<Type>>::create(getWeakPtr(type)));
+  object->setExtra(getAstTypeExtraSlot(), Box<WeakPtr<Type>>::create(getWeakPtr(type)));
 }
 
 template <class OT,
@@ -93,7 +100,7 @@ inline void setAstType(OT *object, Type *type)
   if (metadata == 0) {
     throw EXCEPTION(InvalidArgumentException, S("object"), S("Object does not implement the MetaHaving interface."));
   }
-  metadata->setExtra(META_EXTRA_AST_TYPE, Box<WeakPtr<Type>>::create(getWeakPtr(type)));
+  metadata->setExtra(getAstTypeExtraSlot(), Box<WeakPtr<Type>>::create(getWeakPtr(type)));
 }
 
 } } // namespace
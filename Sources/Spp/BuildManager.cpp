@@ -188,9 +188,10 @@ Bool BuildManager::_execute(
 ) {
   PREPARE_SELF(buildMgr, BuildManager);
 
-  auto minSeverity = buildMgr->rootManager->getMinNoticeSeverityEncountered();
-  auto thisMinSeverity = noticeStore->getMinEncounteredSeverity();
-  if ((minSeverity == -1 || minSeverity > 1) && (thisMinSeverity == -1 || thisMinSeverity > 1)) {
+  // Sessions built before this one need to run first.
+  buildMgr->executeDeferred(noticeStore);
+
+  if (buildMgr->canExecute(noticeStore->getMinEncounteredSeverity())) {
     buildMgr->targetGenerator->execute(buildSession.globalCtorName.c_str());
     buildMgr->targetGenerator->execute(buildSession.globalEntryName.c_str());
     return true;
@@ -200,6 +201,35 @@ Bool BuildManager::_execute(
 }
 
 
+void BuildManager::deferExecution(Core::Notices::Store *noticeStore, SharedPtr<BuildSession> const &buildSession)
+{
+  VALIDATE_NOT_NULL(noticeStore, buildSession);
+  this->deferredExecutions.push_back({ buildSession, noticeStore->getMinEncounteredSeverity() });
+}
+
+
+Bool BuildManager::executeDeferred(Core::Notices::Store *noticeStore)
+{
+  VALIDATE_NOT_NULL(noticeStore);
+  if (this->deferredExecutions.empty()) return true;
+
+  // Executed code can build and defer more sessions, e.g. by importing other sources, so we'll take the list first.
+  std::vector<DeferredExecution> executions;
+  executions.swap(this->deferredExecutions);
+
+  for (auto const &execution : executions) {
+    if (!this->canExecute(execution.minNoticeSeverity)) return false;
+    Word noticeCount = noticeStore->getCount();
+    this->targetGenerator->execute(execution.buildSession->globalCtorName.c_str());
+    this->targetGenerator->execute(execution.buildSession->globalEntryName.c_str());
+    for (Int i = noticeCount; i < static_cast<Int>(noticeStore->getCount()); ++i) {
+      if (noticeStore->get(i)->getSeverity() <= 1) return false;
+    }
+  }
+  return true;
+}
+
+
 void BuildManager::_deleteTempFunctions(TiObject *self, BuildSession &buildSession)
 {
   PREPARE_SELF(buildMgr, BuildManager);
@@ -354,4 +384,11 @@ void BuildManager::prepareFunction(
   }
 }
 
+
+Bool BuildManager::canExecute(Int minNoticeSeverity) const
+{
+  auto rootMinSeverity = this->rootManager->getMinNoticeSeverityEncountered();
+  return (rootMinSeverity == -1 || rootMinSeverity > 1) && (minNoticeSeverity == -1 || minNoticeSeverity > 1);
+}
+
 } // namespace
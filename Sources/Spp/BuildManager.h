@@ -34,6 +34,18 @@ class BuildManager : public TiObject, public DynamicBinding, public DynamicInter
   IMPLEMENT_DYNAMIC_INTERFACING(interfaceList);
 
 
+  //============================================================================
+  // Types
+
+  /// A built session waiting for execution.
+  private: struct DeferredExecution
+  {
+    SharedPtr<BuildSession> buildSession;
+    /// The most severe notice encountered by the end of the session's build.
+    Int minNoticeSeverity;
+  };
+
+
   //============================================================================
   // Member Variables
 
@@ -47,6 +59,8 @@ class BuildManager : public TiObject, public DynamicBinding, public DynamicInter
 
   private: TioSharedPtr globalTgFuncType;
 
+  private: std::vector<DeferredExecution> deferredExecutions;
+
 
   //============================================================================
   // Constructors & Destructor
@@ -156,6 +170,28 @@ class BuildManager : public TiObject, public DynamicBinding, public DynamicInter
 
   private: static void _deleteTempFunctions(TiObject *self, BuildSession &buildSession);
 
+  /**
+   * @brief Queue a finalized build session for execution.
+   *
+   * Deferred sessions are executed in order by executeDeferred(), or before
+   * any other session is executed, so code always runs in the order it was
+   * built. Whether a deferred session can run is decided by the notices
+   * raised by the end of its build rather than by the time of execution, so
+   * errors in sessions built after it don't prevent it from running.
+   */
+  public: void deferExecution(Core::Notices::Store *noticeStore, SharedPtr<BuildSession> const &buildSession);
+
+  /**
+   * @brief Execute the deferred sessions in order.
+   *
+   * Execution stops at the first session that had build errors or after a
+   * session raises errors while running, and the remaining sessions are
+   * dropped.
+   *
+   * @return Returns true if all the deferred sessions were executed.
+   */
+  public: Bool executeDeferred(Core::Notices::Store *noticeStore);
+
   public: METHOD_BINDING_CACHE(dumpLlvmIrForElement,
     void, (TiObject*, Core::Notices::Store*, Core::Processing::Parser*)
   );
@@ -184,6 +220,8 @@ class BuildManager : public TiObject, public DynamicBinding, public DynamicInter
 
   private: TioSharedPtr getVoidNoArgsFuncTgType();
 
+  private: Bool canExecute(Int minNoticeSeverity) const;
+
   private: void prepareFunction(
     Char const *funcName, TiObject *tgFuncType, TioSharedPtr &context, TioSharedPtr &tgFunc
   );
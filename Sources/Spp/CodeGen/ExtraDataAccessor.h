@@ -15,16 +15,16 @@
 
 #define DEFINE_EXTRA_ACCESSORS(name) \
   public: template <class DT, class OT> inline DT* tryGet##name(OT *object) { \
-    return tryGetExtra<DT>(object, this->id##name.c_str()); \
+    return tryGetExtra<DT>(object, this->slot##name); \
   } \
   public: template <class DT, class OT> inline DT* get##name(OT *object) { \
-    return getExtra<DT>(object, this->id##name.c_str()); \
+    return getExtra<DT>(object, this->slot##name); \
   } \
   public: template <class DT, class OT> inline void set##name(OT *object, SharedPtr<DT> const &data) { \
-    setExtra(object, this->id##name.c_str(), data); \
+    setExtra(object, this->slot##name, data); \
   } \
   public: template <class OT> inline void remove##name(OT *object) { \
-    removeExtra(object, this->id##name.c_str()); \
+    removeExtra(object, this->slot##name); \
   }
 
 namespace Spp::CodeGen
@@ -42,11 +42,13 @@ class ExtraDataAccessor : public TiObject
   // Member Variables
 
   private: Str idPrefix;
-  private: Str idCodeGenData;
-  private: Str idAutoCtor;
-  private: Str idAutoDtor;
-  private: Str idCodeGenFailed;
-  private: Str idInitStatementGenIndex;
+
+  /// The extra slot ids of the prefixed names, registered when the prefix is set.
+  private: Word slotCodeGenData;
+  private: Word slotAutoCtor;
+  private: Word slotAutoDtor;
+  private: Word slotCodeGenFailed;
+  private: Word slotInitStatementGenIndex;
 
 
   //============================================================================
@@ -64,11 +66,12 @@ class ExtraDataAccessor : public TiObject
   public: void setIdPrefix(Char const *prefix)
   {
     this->idPrefix = prefix;
-    this->idCodeGenData = this->idPrefix + S("codeGenData");
-    this->idAutoCtor = this->idPrefix + S("autoCtor");
-    this->idAutoDtor = this->idPrefix + S("autoDtor");
-    this->idCodeGenFailed = this->idPrefix + S("codeGenFailed");
-    this->idInitStatementGenIndex = this->idPrefix + S("initStatementGenIndex");
+    this->slotCodeGenData = Core::Data::Ast::MetaExtras::getSlot((this->idPrefix + S("codeGenData")).c_str());
+    this->slotAutoCtor = Core::Data::Ast::MetaExtras::getSlot((this->idPrefix + S("autoCtor")).c_str());
+    this->slotAutoDtor = Core::Data::Ast::MetaExtras::getSlot((this->idPrefix + S("autoDtor")).c_str());
+    this->slotCodeGenFailed = Core::Data::Ast::MetaExtras::getSlot((this->idPrefix + S("codeGenFailed")).c_str());
+    this->slotInitStatementGenIndex =
+      Core::Data::Ast::MetaExtras::getSlot((this->idPrefix + S("initStatementGenIndex")).c_str());
   }
 
   public: Str const& getIdPrefix() const
@@ -86,7 +89,7 @@ class ExtraDataAccessor : public TiObject
   template <class OT, typename std::enable_if<std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
   inline Bool didCodeGenFail(OT *object)
   {
-    auto f = object->getExtra(this->idCodeGenFailed.c_str()).template ti_cast_get<TiBool>();
+    auto f = object->getExtra(this->slotCodeGenFailed).template ti_cast_get<TiBool>();
     return f && f->get();
   }
 
@@ -96,7 +99,7 @@ class ExtraDataAccessor : public TiObject
   {
     auto metadata = ti_cast<Core::Data::Ast::MetaHaving>(object);
     if (metadata == 0) return false;
-    auto f = metadata->getExtra(this->idCodeGenFailed.c_str()).template ti_cast_get<TiBool>();
+    auto f = metadata->getExtra(this->slotCodeGenFailed).template ti_cast_get<TiBool>();
     return f && f->get();
   }
 
@@ -106,7 +109,7 @@ class ExtraDataAccessor : public TiObject
   template <class OT, typename std::enable_if<std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
   inline void setCodeGenFailed(OT *object, Bool f)
   {
-    object->setExtra(this->idCodeGenFailed.c_str(), TiBool::create(f));
+    object->setExtra(this->slotCodeGenFailed, TiBool::create(f));
   }
 
   public:
@@ -117,7 +120,7 @@ class ExtraDataAccessor : public TiObject
     if (metadata == 0) {
       throw EXCEPTION(InvalidArgumentException, S("object"), S("Object does not implement the MetaHaving interface."));
     }
-    metadata->setExtra(this->idCodeGenFailed.c_str(), TiBool::create(f));
+    metadata->setExtra(this->slotCodeGenFailed, TiBool::create(f));
   }
 
   // resetCodeGenFailed
@@ -126,7 +129,7 @@ class ExtraDataAccessor : public TiObject
   template <class OT, typename std::enable_if<std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
   inline void resetCodeGenFailed(OT *object)
   {
-    object->removeExtra(this->idCodeGenFailed.c_str());
+    object->removeExtra(this->slotCodeGenFailed);
   }
 
   public:
@@ -137,7 +140,7 @@ class ExtraDataAccessor : public TiObject
     if (metadata == 0) {
       throw EXCEPTION(InvalidArgumentException, S("object"), S("Object does not implement the MetaHaving interface."));
     }
-    metadata->removeExtra(this->idCodeGenFailed.c_str());
+    metadata->removeExtra(this->slotCodeGenFailed);
   }
 
   // getInitStatementsGenIndex
@@ -146,7 +149,7 @@ class ExtraDataAccessor : public TiObject
   template <class OT, typename std::enable_if<std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
   inline Int getInitStatementsGenIndex(OT *object)
   {
-    auto i = object->getExtra(this->idInitStatementGenIndex.c_str()).template ti_cast_get<TiInt>();
+    auto i = object->getExtra(this->slotInitStatementGenIndex).template ti_cast_get<TiInt>();
     return i == 0 ? 0 : i->get();
   }
 
@@ -156,7 +159,7 @@ class ExtraDataAccessor : public TiObject
   {
     auto metadata = ti_cast<Core::Data::Ast::MetaHaving>(object);
     if (metadata == 0) return false;
-    auto i = metadata->getExtra(this->idInitStatementGenIndex.c_str()).template ti_cast_get<TiInt>();
+    auto i = metadata->getExtra(this->slotInitStatementGenIndex).template ti_cast_get<TiInt>();
     return i == 0 ? 0 : i->get();
   }
 
@@ -165,9 +168,9 @@ class ExtraDataAccessor : public TiObject
   template <class OT, typename std::enable_if<std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
   inline void setInitStatementsGenIndex(OT *object, Int i)
   {
-    auto index = object->getExtra(this->idInitStatementGenIndex.c_str()).template ti_cast_get<TiInt>();
+    auto index = object->getExtra(this->slotInitStatementGenIndex).template ti_cast_get<TiInt>();
     if (index == 0) {
-      object->setExtra(this->idInitStatementGenIndex.c_str(), TiInt::create(i));
+      object->setExtra(this->slotInitStatementGenIndex, TiInt::create(i));
     } else {
       index->set(i);
     }
@@ -180,9 +183,9 @@ class ExtraDataAccessor : public TiObject
     if (metadata == 0) {
       throw EXCEPTION(InvalidArgumentException, S("object"), S("Object does not implement the MetaHaving interface."));
     }
-    auto index = metadata->getExtra(this->idInitStatementGenIndex.c_str()).template ti_cast_get<TiInt>();
+    auto index = metadata->getExtra(this->slotInitStatementGenIndex).template ti_cast_get<TiInt>();
     if (index == 0) {
-      metadata->setExtra(this->idInitStatementGenIndex.c_str(), TiInt::create(i));
+      metadata->setExtra(this->slotInitStatementGenIndex, TiInt::create(i));
     } else {
       index->set(i);
     }
@@ -193,7 +196,7 @@ class ExtraDataAccessor : public TiObject
   template <class OT, typename std::enable_if<std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
   inline void resetInitStatementsGenIndex(OT *object)
   {
-    object->removeExtra(this->idInitStatementGenIndex.c_str());
+    object->removeExtra(this->slotInitStatementGenIndex);
   }
 
   template <class OT, typename std::enable_if<!std::is_base_of<Core::Data::Ast::MetaHaving, OT>::value, int>::type = 0>
@@ -203,7 +206,7 @@ class ExtraDataAccessor : public TiObject
     if (metadata == 0) {
       throw EXCEPTION(InvalidArgumentException, S("object"), S("Object does not implement the MetaHaving interface."));
     }
-    metadata->removeExtra(this->idInitStatementGenIndex.c_str());
+    metadata->removeExtra(this->slotInitStatementGenIndex);
   }
 
 }; // class
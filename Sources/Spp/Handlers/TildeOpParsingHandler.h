@@ -47,7 +47,7 @@ template<class TYPE> class TildeOpParsingHandler : public Core::Processing::Hand
     Core::Processing::Parser *parser, Core::Processing::ParserState *state, Core::Data::Token const *token
   ) {
     auto data = std::make_shared<TYPE>();
-    data->setSourceLocation(std::make_shared<Data::SourceLocationRecord>(token->getSourceLocation()));
+    data->setSourceLocation(newSharedObject<Data::SourceLocationRecord>(token->getSourceLocation()));
     state->setData(data);
   }
 
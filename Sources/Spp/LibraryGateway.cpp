@@ -86,6 +86,18 @@ void LibraryGateway::initialize(Main::RootManager *manager)
   );
 
   // Prepare the target generator.
+  this->jitTargetGenerator->setOptimizationLevel(manager->getOptimizationLevel());
+  this->outputTargetGenerator->setOptimizationLevel(manager->getOptimizationLevel());
+  this->outputTargetGenerator->setNativeCpu(manager->isNativeCpu());
+  if (manager->isJitCacheEnabled()) {
+    auto cacheDir = manager->getJitCacheDirectory();
+    if (cacheDir.empty()) cacheDir = LlvmCodeGen::ObjectCache::getDefaultDirectory();
+    LongWord sizeLimit = manager->getJitCacheSizeLimit();
+    if (sizeLimit == 0) sizeLimit = OBJECT_CACHE_DEFAULT_SIZE_LIMIT;
+    this->jitTargetGenerator->setObjectCache(
+      std::make_shared<LlvmCodeGen::ObjectCache>(cacheDir.c_str(), sizeLimit * 1024 * 1024)
+    );
+  }
   this->jitTargetGenerator->prepareBuild();
   this->outputTargetGenerator->prepareBuild();
 
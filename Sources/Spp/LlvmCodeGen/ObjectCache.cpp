@@ -0,0 +1,137 @@
+/**
+ * @file Spp/LlvmCodeGen/ObjectCache.cpp
+ * Contains the implementation of class Spp::LlvmCodeGen::ObjectCache.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/alusus_license_1_0>.
+ */
+//==============================================================================
+
+#include "spp.h"
+
+namespace Spp { namespace LlvmCodeGen
+{
+
+//==============================================================================
+// Member Functions
+
+Str ObjectCache::getDefaultDirectory()
+{
+  llvm::SmallString<256> path;
+  if (!llvm::sys::path::cache_directory(path)) {
+    // Fall back to the system's temp directory if the user's cache directory can't be determined.
+    llvm::sys::path::system_temp_directory(true, path);
+  }
+  llvm::sys::path::append(path, S("alusus"));
+  return Str(path.c_str());
+}
+
+
+Str ObjectCache::makeKey(llvm::Module const &module, Str const &targetId)
+{
+  std::string ir;
+  llvm::raw_string_ostream irStream(ir);
+  // Objects built by other versions of LLVM aren't reused.
+  irStream << LLVM_VERSION_STRING << "\n" << targetId << "\n";
+  module.print(irStream, nullptr);
+  irStream.flush();
+
+  auto hash = llvm::SHA1::hash(llvm::arrayRefFromStringRef(ir));
+  return Str(llvm::toHex(hash, true).c_str());
+}
+
+
+std::unique_ptr<llvm::MemoryBuffer> ObjectCache::load(Str const &key)
+{
+  auto path = this->getPath(key);
+  auto buffer = llvm::MemoryBuffer::getFile(path);
+  if (!buffer) return nullptr;
+
+  // Refresh the object's modification time so that eviction keeps recently used objects.
+  int fd;
+  if (!llvm::sys::fs::openFileForWrite(path, fd, llvm::sys::fs::CD_OpenExisting)) {
+    llvm::sys::fs::setLastAccessAndModificationTime(
+      fd, std::chrono::time_point_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now())
+    );
+    llvm::sys::Process::SafelyCloseFileDescriptor(fd);
+  }
+
+  return std::move(*buffer);
+}
+
+
+void ObjectCache::store(Str const &key, llvm::MemoryBufferRef object)
+{
+  if (llvm::sys::fs::create_directories(this->directory)) return;
+
+  // Write to a temp file then rename it so other processes never see a partially written object.
+  llvm::SmallString<256> tempPath;
+  int fd;
+  if (llvm::sys::fs::createUniqueFile(this->directory + S("/%%%%%%%%%%%%.tmp"), fd, tempPath)) return;
+  {
+    llvm::raw_fd_ostream out(fd, true);
+    out << object.getBuffer();
+    out.close();
+    if (out.has_error()) {
+      out.clear_error();
+      llvm::sys::fs::remove(tempPath);
+      return;
+    }
+  }
+  if (llvm::sys::fs::rename(tempPath, this->getPath(key))) {
+    llvm::sys::fs::remove(tempPath);
+    return;
+  }
+
+  if (this->totalSize == -1) {
+    this->evict();
+  } else {
+    this->totalSize += object.getBufferSize();
+    if (this->totalSize > static_cast<LongInt>(this->sizeLimit)) this->evict();
+  }
+}
+
+
+Str ObjectCache::getPath(Str const &key) const
+{
+  return this->directory + S("/") + key + S(".o");
+}
+
+
+void ObjectCache::evict()
+{
+  struct Entry
+  {
+    std::string path;
+    llvm::sys::TimePoint<> time;
+    LongWord size;
+  };
+  std::vector<Entry> entries;
+  LongWord totalSize = 0;
+
+  std::error_code ec;
+  for (llvm::sys::fs::directory_iterator it(this->directory, ec), end; it != end && !ec; it.increment(ec)) {
+    if (llvm::sys::path::extension(it->path()) != S(".o")) continue;
+    llvm::sys::fs::file_status status;
+    if (llvm::sys::fs::status(it->path(), status)) continue;
+    entries.push_back({ it->path(), status.getLastModificationTime(), status.getSize() });
+    totalSize += status.getSize();
+  }
+
+  if (totalSize > this->sizeLimit) {
+    std::sort(entries.begin(), entries.end(), [](Entry const &e1, Entry const &e2)->bool {
+      return e1.time < e2.time;
+    });
+    for (auto const &entry : entries) {
+      if (totalSize <= this->sizeLimit) break;
+      if (!llvm::sys::fs::remove(entry.path)) totalSize -= entry.size;
+    }
+  }
+
+  this->totalSize = totalSize;
+}
+
+} } // namespace
@@ -0,0 +1,100 @@
+/**
+ * @file Spp/LlvmCodeGen/ObjectCache.h
+ * Contains the header of class Spp::LlvmCodeGen::ObjectCache.
+ *
+ * @copyright Copyright (C) 2020 Sarmad Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/alusus_license_1_0>.
+ */
+//==============================================================================
+
+#ifndef SPP_LLVMCODEGEN_OBJECTCACHE_H
+#define SPP_LLVMCODEGEN_OBJECTCACHE_H
+
+namespace Spp { namespace LlvmCodeGen
+{
+
+/**
+ * @brief An on-disk cache of JIT compiled object files.
+ * @ingroup spp_llvmcodegen
+ *
+ * Objects are keyed by a hash of the module's IR before optimization along
+ * with the target triple, the CPU and its features, the optimization level,
+ * and the LLVM version, so an object is only reused if compiling the module
+ * again would produce the same code. Modules that embed addresses of the
+ * running process get different keys on every run and are effectively never
+ * reused.
+ *
+ * Objects are written to a temporary file first and then renamed, so
+ * multiple processes can share the same directory. When the total size of
+ * the cached objects exceeds the size limit, the least recently used objects
+ * are removed. Failing to read or write the cache isn't an error; the module
+ * just gets compiled as if it wasn't cached.
+ */
+class ObjectCache
+{
+  //============================================================================
+  // Member Variables
+
+  private: Str directory;
+
+  private: LongWord sizeLimit;
+
+  /// The total size of the cached objects, or -1 if it's not yet known.
+  private: LongInt totalSize = -1;
+
+
+  //============================================================================
+  // Constructor
+
+  /**
+   * @param directory The cache's directory, which is created when the first
+   *                  object is stored.
+   * @param sizeLimit The maximum total size of the cached objects in bytes.
+   */
+  public: ObjectCache(Char const *directory, LongWord sizeLimit) : directory(directory), sizeLimit(sizeLimit)
+  {
+  }
+
+
+  //============================================================================
+  // Member Functions
+
+  /// Get the default directory, which is the alusus directory within the user's cache directory.
+  public: static Str getDefaultDirectory();
+
+  public: Str const& getDirectory() const
+  {
+    return this->directory;
+  }
+
+  public: LongWord getSizeLimit() const
+  {
+    return this->sizeLimit;
+  }
+
+  /**
+   * @brief Compute the key of the given module.
+   * @param targetId A string identifying the target triple, the CPU and its
+   *                 features, and the optimization level.
+   */
+  public: static Str makeKey(llvm::Module const &module, Str const &targetId);
+
+  /// Load the object stored under the given key, or return null if it's not cached.
+  public: std::unique_ptr<llvm::MemoryBuffer> load(Str const &key);
+
+  /// Store the given object under the given key, evicting older objects if needed.
+  public: void store(Str const &key, llvm::MemoryBufferRef object);
+
+  private: Str getPath(Str const &key) const;
+
+  /// Remove the least recently used objects until the total size is within the limit.
+  private: void evict();
+
+}; // class
+
+} } // namespace
+
+#endif
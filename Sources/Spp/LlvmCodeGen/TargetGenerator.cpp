@@ -138,11 +138,13 @@ void TargetGenerator::prepareBuild()
   LLVMInitializeNativeAsmPrinter();
   LLVMInitializeNativeAsmParser();
 
-  // The llvm module should we always be released before the context.
+  // The JIT and the llvm module should we always be released before the context.
+  this->jit.reset();
+  this->jitTargetMachine.reset();
   this->llvmModule.reset();
   this->llvmDataLayout = std::make_shared<llvm::DataLayout>("");
-  this->llvmContext = std::make_shared<llvm::LLVMContext>();
-  this->llvmModule = std::make_unique<llvm::Module>("AlususProgram", *this->llvmContext);
+  this->llvmContext = llvm::orc::ThreadSafeContext(std::make_unique<llvm::LLVMContext>());
+  this->llvmModule = std::make_unique<llvm::Module>("AlususProgram", *this->llvmContext.getContext());
   this->llvmModule->setDataLayout(this->llvmDataLayout->getStringRepresentation());
   this->executionContext = std::make_shared<ExecutionContext>(llvmDataLayout->getPointerSizeInBits());
 }
@@ -150,10 +152,12 @@ void TargetGenerator::prepareBuild()
 
 void TargetGenerator::resetBuild()
 {
-  // The llvm module should we always be released before the context.
+  // The JIT and the llvm module should we always be released before the context.
+  this->jit.reset();
+  this->jitTargetMachine.reset();
   this->llvmModule.reset();
-  this->llvmContext = std::make_shared<llvm::LLVMContext>();
-  this->llvmModule = std::make_unique<llvm::Module>("AlususProgram", *this->llvmContext);
+  this->llvmContext = llvm::orc::ThreadSafeContext(std::make_unique<llvm::LLVMContext>());
+  this->llvmModule = std::make_unique<llvm::Module>("AlususProgram", *this->llvmContext.getContext());
   this->llvmModule->setDataLayout(this->llvmDataLayout->getStringRepresentation());
   this->blockIndex = 0;
   this->anonymousVarIndex = 0;
@@ -191,14 +195,26 @@ void TargetGenerator::buildObjectFile(Char const *filename)
     throw EXCEPTION(GenericException, error.c_str());
   }
 
-  auto cpu = "generic";
-  auto features = "";
+  std::string cpu = "generic";
+  std::string features = "";
+  if (this->nativeCpu) {
+    cpu = llvm::sys::getHostCPUName().str();
+    llvm::SubtargetFeatures subtargetFeatures;
+    llvm::StringMap<bool> hostFeatures;
+    if (llvm::sys::getHostCPUFeatures(hostFeatures)) {
+      for (auto &feature : hostFeatures) subtargetFeatures.AddFeature(feature.first(), feature.second);
+    }
+    features = subtargetFeatures.getString();
+  }
 
   llvm::TargetOptions opt;
   auto rm = llvm::Optional<llvm::Reloc::Model>();
-  auto theTargetMachine = target->createTargetMachine(targetTriple, cpu, features, opt, rm);
+  std::unique_ptr<llvm::TargetMachine> theTargetMachine(target->createTargetMachine(
+    targetTriple, cpu, features, opt, rm, llvm::None, TargetGenerator::getCodeGenOptLevel(this->optimizationLevel)
+  ));
 
   this->llvmModule->setDataLayout(theTargetMachine->createDataLayout());
+  TargetGenerator::optimizeModule(*this->llvmModule, this->optimizationLevel, theTargetMachine.get());
 
   std::error_code ec;
   llvm::raw_fd_ostream dest(filename, ec, llvm::sys::fs::F_None);
@@ -225,39 +241,212 @@ void TargetGenerator::execute(Char const *entry)
     throw EXCEPTION(GenericException, S("LLVM module is not generated yet."));
   }
 
+  if (this->jit == 0) this->prepareJit();
+
+  // We need to make sure the JIT and the LLVMContext don't get deleted while we are executing the function, so
+  // we'll capture shared copies of them in case they get replaced during the execution of the function.
+  auto jit = this->jit;
+  auto llvmContextCopy = this->llvmContext;
+
+  // Add mappings for the global variables added since the last execution.
+  if (this->globalItemRepo != 0 && this->globalItemRepo->getItemCount() > this->jitGlobalItemCount) {
+    llvm::orc::SymbolMap symbols;
+    for (Int i = this->jitGlobalItemCount; i < this->globalItemRepo->getItemCount(); ++i) {
+      symbols[jit->mangleAndIntern(this->globalItemRepo->getItemName(i).c_str())] = llvm::JITEvaluatedSymbol(
+        llvm::pointerToJITTargetAddress(this->globalItemRepo->getItemPtr(i)), llvm::JITSymbolFlags::Exported
+      );
+    }
+    if (auto error = jit->getMainJITDylib().define(llvm::orc::absoluteSymbols(std::move(symbols)))) {
+      throw EXCEPTION(GenericException, llvm::toString(std::move(error)).c_str());
+    }
+    this->jitGlobalItemCount = this->globalItemRepo->getItemCount();
+  }
+
   // Detach all incomplete functions.
   for (Int i = 0; i < this->incompleteFunctions.size(); ++i) {
     this->incompleteFunctions[i]->removeFromParent();
   }
 
-  auto engineBuilder = llvm::EngineBuilder(llvm::CloneModule(*this->llvmModule));
-  std::string errorStr;
-  engineBuilder.setErrorStr(&errorStr);
-  auto ee = engineBuilder.create();
+  // Only the definitions that weren't added in previous executions are compiled. Definitions that are already in
+  // the JIT are cloned as declarations and get resolved to the previously compiled code.
+  llvm::ValueToValueMapTy valueMap;
+  auto module = llvm::CloneModule(*this->llvmModule, valueMap, [=](llvm::GlobalValue const *gv)->bool {
+    return gv->hasLocalLinkage() || this->jitSymbols.count(gv->getName().str()) == 0;
+  });
+
+  // Re-attach all incomplete functions.
+  for (Int i = 0; i < this->incompleteFunctions.size(); ++i) {
+    this->llvmModule->getFunctionList().push_back(this->incompleteFunctions[i]);
+  }
 
-  // Add global variable mappings.
-  if (this->globalItemRepo != 0) {
-    for (Int i = 0; i < this->globalItemRepo->getItemCount(); ++i) {
-      auto varName = this->globalItemRepo->getItemName(i).c_str();
-      auto varPtr = (uint64_t)this->globalItemRepo->getItemPtr(i);
-      ee->addGlobalMapping(varName, varPtr);
+  // Local definitions are always cloned since they can't be referenced across modules, so we'll drop the ones
+  // that aren't used by the new definitions.
+  Bool erased;
+  do {
+    erased = false;
+    for (auto it = module->global_begin(); it != module->global_end();) {
+      auto &var = *it++;
+      if (var.hasLocalLinkage() && var.use_empty()) {
+        var.eraseFromParent();
+        erased = true;
+      }
+    }
+  } while (erased);
+
+  Bool hasNewDefinitions = false;
+  for (auto &gv : module->global_values()) {
+    if (!gv.isDeclaration() && !gv.hasLocalLinkage()) {
+      this->jitSymbols.insert(gv.getName().str());
+      hasNewDefinitions = true;
+    }
+  }
+  if (hasNewDefinitions) {
+    if (auto error = jit->addIRModule(llvm::orc::ThreadSafeModule(std::move(module), llvmContextCopy))) {
+      throw EXCEPTION(GenericException, llvm::toString(std::move(error)).c_str());
     }
   }
 
-  typedef void (*FuncType)();
-  auto funcPtr = (FuncType)ee->getFunctionAddress(entry);
+  auto symbol = jit->lookup(entry);
+  if (!symbol) {
+    throw EXCEPTION(GenericException, llvm::toString(symbol.takeError()).c_str());
+  }
 
-  // We need to make sure the LLVMContext doesn't get deleted while we are executing the function, so we'll capture
-  // a shared copy of the context in case the ptr gets replaced during the execution of the function.
-  SharedPtr<llvm::LLVMContext> llvmContextCopy = this->llvmContext;
+  typedef void (*FuncType)();
+  auto funcPtr = (FuncType)symbol->getAddress();
 
   funcPtr();
+}
 
-  delete ee;
 
-  // Re-attach all incomplete functions.
-  for (Int i = 0; i < this->incompleteFunctions.size(); ++i) {
-    this->llvmModule->getFunctionList().push_back(this->incompleteFunctions[i]);
+void TargetGenerator::prepareJit()
+{
+  // JIT compiled code always runs on the host, so we'll target the host's CPU and its features.
+  auto jtmb = llvm::orc::JITTargetMachineBuilder::detectHost();
+  if (!jtmb) {
+    throw EXCEPTION(GenericException, llvm::toString(jtmb.takeError()).c_str());
+  }
+  auto cpu = llvm::sys::getHostCPUName().str();
+  jtmb->setCPU(cpu);
+  jtmb->setCodeGenOptLevel(TargetGenerator::getCodeGenOptLevel(this->optimizationLevel));
+
+  auto targetMachine = jtmb->createTargetMachine();
+  if (!targetMachine) {
+    throw EXCEPTION(GenericException, llvm::toString(targetMachine.takeError()).c_str());
+  }
+  this->jitTargetMachine = SharedPtr<llvm::TargetMachine>(targetMachine->release());
+
+  // Modules are optimized and compiled by our own compile function so that modules found in the object cache skip
+  // both steps. Settings are captured now since the session is kept across executions.
+  auto level = this->optimizationLevel;
+  auto jitTargetMachine = this->jitTargetMachine;
+  auto objectCache = this->objectCache;
+  Str targetId = jtmb->getTargetTriple().str() + S(" ") + cpu + S(" ") +
+    jtmb->getFeatures().getString() + S(" O") + std::to_string(level);
+  auto compileFunctionCreator = [=](llvm::orc::JITTargetMachineBuilder)
+    ->llvm::Expected<llvm::orc::IRCompileLayer::CompileFunction>
+  {
+    return llvm::orc::IRCompileLayer::CompileFunction(
+      [=](llvm::Module &module)->llvm::Expected<std::unique_ptr<llvm::MemoryBuffer>> {
+        auto object = TargetGenerator::compileModule(
+          module, level, jitTargetMachine.get(), objectCache.get(), targetId
+        );
+        if (object == nullptr) {
+          return llvm::make_error<llvm::StringError>(
+            S("Failed to compile module for JIT execution."), llvm::inconvertibleErrorCode()
+          );
+        }
+        return std::move(object);
+      }
+    );
+  };
+
+  auto jit = llvm::orc::LLJITBuilder()
+    .setJITTargetMachineBuilder(std::move(*jtmb))
+    .setCompileFunctionCreator(compileFunctionCreator)
+    .create();
+  if (!jit) {
+    throw EXCEPTION(GenericException, llvm::toString(jit.takeError()).c_str());
+  }
+  this->jit = std::move(*jit);
+
+  // Resolve symbols not defined by the program from the running process, the way MCJIT did.
+  auto generator = llvm::orc::DynamicLibrarySearchGenerator::GetForCurrentProcess(
+    this->jit->getDataLayout().getGlobalPrefix()
+  );
+  if (!generator) {
+    throw EXCEPTION(GenericException, llvm::toString(generator.takeError()).c_str());
+  }
+  this->jit->getMainJITDylib().addGenerator(std::move(*generator));
+
+  this->jitSymbols.clear();
+  this->jitGlobalItemCount = 0;
+}
+
+
+void TargetGenerator::optimizeModule(llvm::Module &module, Int level, llvm::TargetMachine *targetMachine)
+{
+  llvm::PassBuilder::OptimizationLevel optLevel;
+  switch (level) {
+    case 0: return;
+    case 1: optLevel = llvm::PassBuilder::OptimizationLevel::O1; break;
+    case 2: optLevel = llvm::PassBuilder::OptimizationLevel::O2; break;
+    default: optLevel = llvm::PassBuilder::OptimizationLevel::O3; break;
+  }
+
+  llvm::LoopAnalysisManager lam;
+  llvm::FunctionAnalysisManager fam;
+  llvm::CGSCCAnalysisManager cgam;
+  llvm::ModuleAnalysisManager mam;
+
+  llvm::PassBuilder passBuilder(targetMachine);
+  passBuilder.registerModuleAnalyses(mam);
+  passBuilder.registerCGSCCAnalyses(cgam);
+  passBuilder.registerFunctionAnalyses(fam);
+  passBuilder.registerLoopAnalyses(lam);
+  passBuilder.crossRegisterProxies(lam, fam, cgam, mam);
+
+  auto mpm = passBuilder.buildPerModuleDefaultPipeline(optLevel);
+  mpm.run(module, mam);
+}
+
+
+std::unique_ptr<llvm::MemoryBuffer> TargetGenerator::compileModule(
+  llvm::Module &module, Int level, llvm::TargetMachine *targetMachine, ObjectCache *objectCache, Str const &targetId
+) {
+  // The key is computed before optimizing since optimization modifies the module.
+  Str key;
+  if (objectCache != 0) {
+    key = ObjectCache::makeKey(module, targetId);
+    auto object = objectCache->load(key);
+    if (object != nullptr) return object;
+  }
+
+  TargetGenerator::optimizeModule(module, level, targetMachine);
+
+  llvm::SmallVector<char, 0> objectBuffer;
+  {
+    llvm::raw_svector_ostream objectStream(objectBuffer);
+    llvm::legacy::PassManager passManager;
+    llvm::MCContext *mcContext;
+    if (targetMachine->addPassesToEmitMC(passManager, mcContext, objectStream)) return nullptr;
+    passManager.run(module);
+  }
+  std::unique_ptr<llvm::MemoryBuffer> object = std::make_unique<llvm::SmallVectorMemoryBuffer>(
+    std::move(objectBuffer)
+  );
+
+  if (objectCache != 0) objectCache->store(key, object->getMemBufferRef());
+  return object;
+}
+
+
+llvm::CodeGenOpt::Level TargetGenerator::getCodeGenOptLevel(Int level)
+{
+  switch (level) {
+    case 0: return llvm::CodeGenOpt::None;
+    case 1: return llvm::CodeGenOpt::Less;
+    case 2: return llvm::CodeGenOpt::Default;
+    default: return llvm::CodeGenOpt::Aggressive;
   }
 }
 
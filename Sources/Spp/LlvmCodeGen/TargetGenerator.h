@@ -43,7 +43,34 @@ class TargetGenerator : public TiObject, public DynamicBinding, public DynamicIn
   private: std::vector<llvm::Function*> incompleteFunctions;
   private: std::unique_ptr<llvm::Module> llvmModule;
   private: SharedPtr<llvm::DataLayout> llvmDataLayout;
-  private: SharedPtr<llvm::LLVMContext> llvmContext;
+  private: llvm::orc::ThreadSafeContext llvmContext;
+
+  /**
+   * @brief The JIT session used by execute().
+   * The session is created on the first execution and is kept until the build
+   * is reset, so every execution only compiles the definitions generated
+   * since the previous one.
+   */
+  private: SharedPtr<llvm::orc::LLJIT> jit;
+
+  /// The names of the module's definitions that were already added to the JIT.
+  private: std::unordered_set<std::string> jitSymbols;
+
+  /// The number of entries of globalItemRepo that were already defined in the JIT.
+  private: Word jitGlobalItemCount = 0;
+
+  /// The target machine of the JIT session, which targets the host CPU and its features.
+  private: SharedPtr<llvm::TargetMachine> jitTargetMachine;
+
+  /// The on-disk cache of JIT compiled objects, or null if caching is disabled.
+  private: SharedPtr<ObjectCache> objectCache;
+
+  /// The optimization level, from 0 (no optimization) to 3.
+  private: Int optimizationLevel = 0;
+
+  /// Whether object files target the host CPU and its features rather than a generic CPU.
+  private: Bool nativeCpu = false;
+
   private: Int blockIndex = 0;
   private: Int anonymousVarIndex = 0;
 
@@ -65,8 +92,10 @@ class TargetGenerator : public TiObject, public DynamicBinding, public DynamicIn
 
   public: virtual ~TargetGenerator()
   {
-    // The llvm module should we always be released before the context, so we'll need to manually release the
-    // module before the default destructors are triggered.
+    // The JIT and the llvm module should we always be released before the context, so we'll need to manually
+    // release them before the default destructors are triggered.
+    this->jit.reset();
+    this->jitTargetMachine.reset();
     this->llvmModule.reset();
   }
 
@@ -94,11 +123,85 @@ class TargetGenerator : public TiObject, public DynamicBinding, public DynamicIn
 
   public: void execute(Char const *entry);
 
+  private: void prepareJit();
+
+  /**
+   * @brief Run the default optimization pipeline of the given level on a module.
+   * Uses the new pass manager. Nothing is done for level 0.
+   * @param targetMachine The target whose cost model is used by the passes,
+   *                      or null to use a generic cost model.
+   */
+  private: static void optimizeModule(llvm::Module &module, Int level, llvm::TargetMachine *targetMachine);
+
+  /**
+   * @brief Optimize and compile a module of the JIT session into an object.
+   * If an object cache is given, the object is loaded from the cache if
+   * available, in which case the module isn't optimized or compiled, and is
+   * otherwise stored in the cache after compiling.
+   * @return The compiled object, or null if the target can't emit objects.
+   */
+  private: static std::unique_ptr<llvm::MemoryBuffer> compileModule(
+    llvm::Module &module, Int level, llvm::TargetMachine *targetMachine, ObjectCache *objectCache,
+    Str const &targetId
+  );
+
+  private: static llvm::CodeGenOpt::Level getCodeGenOptLevel(Int level);
+
   /// @}
 
   /// @name Property Getters
   /// @{
 
+  /**
+   * @brief Set the optimization level of generated code.
+   * Levels range from 0 (no optimization) to 3 and correspond to the O0-O3
+   * levels of LLVM. The level affects both the JIT and object files, but
+   * changing it doesn't affect code that was already compiled by the JIT.
+   */
+  public: void setOptimizationLevel(Int level)
+  {
+    if (level < 0 || level > 3) {
+      throw EXCEPTION(InvalidArgumentException, S("level"), S("Must be between 0 and 3."), level);
+    }
+    this->optimizationLevel = level;
+  }
+
+  public: Int getOptimizationLevel() const
+  {
+    return this->optimizationLevel;
+  }
+
+  /**
+   * @brief Set whether object files target the host CPU.
+   * When enabled, object files are built for the CPU and CPU features of the
+   * host machine, similar to -march=native, and may not run on other machines.
+   * JIT compiled code always targets the host.
+   */
+  public: void setNativeCpu(Bool n)
+  {
+    this->nativeCpu = n;
+  }
+
+  public: Bool isNativeCpu() const
+  {
+    return this->nativeCpu;
+  }
+
+  /**
+   * @brief Set the on-disk cache used for JIT compiled objects.
+   * Set to null to disable caching. Changing the cache doesn't affect the
+   * current JIT session.
+   */
+  public: void setObjectCache(SharedPtr<ObjectCache> const &cache)
+  {
+    this->objectCache = cache;
+  }
+
+  public: SharedPtr<ObjectCache> const& getObjectCache() const
+  {
+    return this->objectCache;
+  }
+
   public: void setGlobalItemRepo(CodeGen::GlobalItemRepo *vr)
   {
     this->globalItemRepo = vr;
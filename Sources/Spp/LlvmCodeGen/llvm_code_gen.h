@@ -26,6 +26,16 @@ namespace Spp { namespace LlvmCodeGen
 } } // namespace
 
 
+//==============================================================================
+// Macros
+
+/**
+ * @brief The default size limit of the JIT object cache in megabytes.
+ * @ingroup spp_llvmcodegen
+ */
+#define OBJECT_CACHE_DEFAULT_SIZE_LIMIT 512
+
+
 //==============================================================================
 // Classes
 
@@ -40,6 +50,7 @@ namespace Spp { namespace LlvmCodeGen
 #include "LoopContext.h"
 
 // The Generator
+#include "ObjectCache.h"
 #include "TargetGenerator.h"
 
 #endif
@@ -14,11 +14,12 @@
 #define SCG_CODEGENUNIT_H
 
 #undef C
+#undef S
 
 #include <llvm/IR/IRPrintingPasses.h>
-#include <llvm/ExecutionEngine/ExecutionEngine.h>
-#include <llvm/ExecutionEngine/GenericValue.h>
-#include <llvm/ExecutionEngine/MCJIT.h>
+#include <llvm/ExecutionEngine/Orc/LLJIT.h>
+#include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
+#include <llvm/ExecutionEngine/Orc/ThreadSafeModule.h>
 #include <llvm/IR/Attributes.h>
 #include <llvm/IR/Module.h>
 #include <llvm/IR/IRBuilder.h>
@@ -28,13 +29,26 @@
 #include <llvm/Linker/Linker.h>
 #include <llvm/IR/LegacyPassManager.h>
 #include <llvm/Support/TargetSelect.h>
+#include <llvm-c/Target.h>
 #include <llvm/Support/raw_ostream.h>
 #include <llvm/Support/raw_os_ostream.h>
 #include <llvm/Support/TargetRegistry.h>
+#include <llvm/Support/Host.h>
+#include <llvm/Target/TargetMachine.h>
+#include <llvm/Passes/PassBuilder.h>
+#include <llvm/Config/llvm-config.h>
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Support/SHA1.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Process.h>
+#include <llvm/Support/SmallVectorMemoryBuffer.h>
 #include <llvm/Transforms/Utils/Cloning.h>
 
 #undef C
 #define C(x)	u8##x
+#undef S
+#define S(x)	u8##x
 
 
 DEFINE_TYPE_NAME(llvm::Module, "llvm.org/LLVM/llvm.Module");
@@ -26,7 +26,10 @@ RootScopeHandlerExtension::Overrides* RootScopeHandlerExtension::extend(
 
   auto overrides = new Overrides();
   extension->rootManagerBox = Box<Core::Main::RootManager*>::create(rootManager);
+  extension->pendingElements = SharedList<TiObject>::create({});
   overrides->addNewElementRef = handler->addNewElement.set(&RootScopeHandlerExtension::_addNewElement).get();
+  overrides->flushPendingElementsRef =
+    handler->flushPendingElements.set(&RootScopeHandlerExtension::_flushPendingElements).get();
 
   return overrides;
 }
@@ -36,7 +39,9 @@ void RootScopeHandlerExtension::unextend(Core::Main::RootScopeHandler *handler,
 {
   auto extension = ti_cast<RootScopeHandlerExtension>(handler);
   handler->addNewElement.reset(overrides->addNewElementRef);
+  handler->flushPendingElements.reset(overrides->flushPendingElementsRef);
   extension->rootManagerBox.remove();
+  extension->pendingElements.remove();
   handler->removeDynamicInterface<RootScopeHandlerExtension>();
   delete overrides;
 }
@@ -50,7 +55,17 @@ void RootScopeHandlerExtension::_addNewElement(
   Core::Processing::Parser *parser, Core::Processing::ParserState *state
 ) {
   PREPARE_SELF(rootScopeHandler, Core::Main::RootScopeHandler);
+  PREPARE_SELF(extension, RootScopeHandlerExtension);
   auto root = rootScopeHandler->getRootScope().get();
+  auto rootManager = extension->rootManagerBox->get();
+
+  // In batched mode, plain statements wait until something needs them to be executed. Anything else needs the
+  // pending statements to be executed before it's added.
+  Bool deferred = false;
+  if (data != 0 && rootManager->isBatchedExecution()) {
+    deferred = RootScopeHandlerExtension::isDeferrable(data.get(), rootManager->getSeeker(), root);
+    if (!deferred) rootScopeHandler->flushPendingElements(parser, state);
+  }
 
   auto start = root->getCount();
   rootScopeHandler->addNewElement.useCallee(base)(data, parser, state);
@@ -61,16 +76,13 @@ void RootScopeHandlerExtension::_addNewElement(
     if (root->get(i) != 0 && !root->get(i)->isDerivedFrom<Core::Data::Ast::Definition>()) execute = true;
   }
 
-  if (execute) {
-    PREPARE_SELF(extension, RootScopeHandlerExtension);
-    auto rootManager = extension->rootManagerBox->get();
+  if (execute && deferred) {
+    for (Int i = start; i <= end; ++i) {
+      if (root->get(i) != 0) extension->pendingElements->add(root->get(i));
+    }
+  } else if (execute) {
     auto rootManagerExt = ti_cast<RootManagerExtension>(rootManager);
-
-    // Prepare rtAstMgr & rtBuildMgr
-    rootManagerExt->rtAstMgr->setParser(parser);
-    rootManagerExt->rtAstMgr->setNoticeStore(state->getNoticeStore());
-    rootManagerExt->rtBuildMgr->setParser(parser);
-    rootManagerExt->rtBuildMgr->setNoticeStore(state->getNoticeStore());
+    RootScopeHandlerExtension::prepareRtManagers(rootManager, parser, state);
 
     // Process macros.
     auto astProcessor = rootManagerExt->jitBuildManager->getAstProcessor();
@@ -113,4 +125,136 @@ void RootScopeHandlerExtension::_addNewElement(
   }
 }
 
+
+void RootScopeHandlerExtension::_flushPendingElements(
+  TiFunctionBase *base, TiObject *self, Core::Processing::Parser *parser, Core::Processing::ParserState *state
+) {
+  PREPARE_SELF(rootScopeHandler, Core::Main::RootScopeHandler);
+  PREPARE_SELF(extension, RootScopeHandlerExtension);
+  rootScopeHandler->flushPendingElements.useCallee(base)(parser, state);
+
+  if (extension->pendingElements->getCount() == 0) return;
+
+  // Take the pending statements out first since executing them can parse other sources that add their own.
+  SharedPtr<SharedList<TiObject>> elements = extension->pendingElements;
+  extension->pendingElements = SharedList<TiObject>::create({});
+
+  auto rootManager = extension->rootManagerBox->get();
+  auto rootManagerExt = ti_cast<RootManagerExtension>(rootManager);
+  auto root = rootManager->getRootScope().get();
+  RootScopeHandlerExtension::prepareRtManagers(rootManager, parser, state);
+
+  // Process macros. Pending statements don't use macros, so this only processes the definitions added since the
+  // last execution.
+  auto astProcessor = rootManagerExt->jitBuildManager->getAstProcessor();
+  astProcessor->preparePass(state->getNoticeStore());
+  if (!astProcessor->process(root)) return;
+
+  auto jitBuildManager = rootManagerExt->jitBuildManager.get();
+  auto building = ti_cast<Building>(jitBuildManager);
+
+  // Each statement gets its own session so that global variables are still initialized right before the first
+  // statement that uses them, but all sessions are built before executing any of them so that the JIT compiles them
+  // together. Evals that run while a statement is being built execute the previously built statements first.
+  std::vector<SharedPtr<BuildSession>> buildSessions;
+  for (Int i = 0; i < elements->getCount(); ++i) {
+    auto buildSession = std::make_shared<BuildSession>();
+    building->prepareExecution(state->getNoticeStore(), root, *buildSession);
+
+    Bool execute = true;
+
+    if (i == 0) {
+      // Definitions are never deferred, so all the modules precede the pending statements.
+      for (Int j = 0; j < root->getCount(); ++j) {
+        auto def = ti_cast<Core::Data::Ast::Definition>(root->get(j));
+        if (def != 0) {
+          auto module = def->getTarget().ti_cast_get<Spp::Ast::Module>();
+          if (module != 0) {
+            if (!building->addElementToBuild(def.get(), *buildSession)) execute = false;
+          }
+        }
+      }
+    }
+
+    if (!building->addElementToBuild(elements->get(i).get(), *buildSession)) execute = false;
+
+    building->finalizeBuild(state->getNoticeStore(), root, *buildSession);
+    if (execute) jitBuildManager->deferExecution(state->getNoticeStore(), buildSession);
+    buildSessions.push_back(buildSession);
+  }
+
+  jitBuildManager->executeDeferred(state->getNoticeStore());
+
+  for (auto &buildSession : buildSessions) {
+    building->deleteTempFunctions(*buildSession);
+  }
+}
+
+
+//==============================================================================
+// Helper Functions
+
+void RootScopeHandlerExtension::prepareRtManagers(
+  Core::Main::RootManager *rootManager, Core::Processing::Parser *parser, Core::Processing::ParserState *state
+) {
+  auto rootManagerExt = ti_cast<RootManagerExtension>(rootManager);
+  rootManagerExt->rtAstMgr->setParser(parser);
+  rootManagerExt->rtAstMgr->setNoticeStore(state->getNoticeStore());
+  rootManagerExt->rtBuildMgr->setParser(parser);
+  rootManagerExt->rtBuildMgr->setNoticeStore(state->getNoticeStore());
+}
+
+
+Bool RootScopeHandlerExtension::isDeferrable(
+  TiObject *element, Core::Data::Seeker *seeker, Core::Data::Ast::Scope *root
+) {
+  if (
+    element->isDerivedFrom<Core::Data::Ast::Definition>() ||
+    element->isDerivedFrom<Core::Data::Ast::Bridge>() ||
+    element->isDerivedFrom<Core::Data::Ast::MergeList>()
+  ) {
+    return false;
+  }
+  return !RootScopeHandlerExtension::isExecutionBarrier(element, seeker, root);
+}
+
+
+Bool RootScopeHandlerExtension::isExecutionBarrier(
+  TiObject *obj, Core::Data::Seeker *seeker, Core::Data::Ast::Scope *root
+) {
+  if (obj->isDerivedFrom<Ast::EvalStatement>() || obj->isDerivedFrom<Ast::Macro>()) {
+    return true;
+  } else if (obj->isDerivedFrom<Core::Data::Ast::Identifier>()) {
+    auto identifier = static_cast<Core::Data::Ast::Identifier*>(obj);
+    return identifier->getValue() == S("Core") || identifier->getValue() == S("Spp");
+  } else if (obj->isDerivedFrom<Core::Data::Ast::ParamPass>()) {
+    auto paramPass = static_cast<Core::Data::Ast::ParamPass*>(obj);
+    if (paramPass->getType() == Core::Data::Ast::BracketType::SQUARE && paramPass->getOperand() != 0) {
+      // The statement isn't in the root scope yet, so we'll look for the macro from the root scope.
+      Bool isMacro = false;
+      seeker->foreach(paramPass->getOperand().get(), root,
+        [&isMacro] (TiObject *found, Core::Notices::Notice *ntc)->Core::Data::Seeker::Verb
+        {
+          if (ntc == 0 && found != 0 && found->isDerivedFrom<Ast::Macro>()) {
+            isMacro = true;
+            return Core::Data::Seeker::Verb::STOP;
+          } else {
+            return Core::Data::Seeker::Verb::MOVE;
+          }
+        }, 0
+      );
+      if (isMacro) return true;
+    }
+  }
+
+  auto container = ti_cast<Containing<TiObject>>(obj);
+  if (container != 0) {
+    for (Int i = 0; i < container->getElementCount(); ++i) {
+      auto child = container->getElement(i);
+      if (child != 0 && RootScopeHandlerExtension::isExecutionBarrier(child, seeker, root)) return true;
+    }
+  }
+  return false;
+}
+
 } // namespace
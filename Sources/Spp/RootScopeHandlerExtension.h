@@ -30,6 +30,7 @@ class RootScopeHandlerExtension : public ObjTiInterface
   public: struct Overrides
   {
     TiFunctionBase *addNewElementRef;
+    TiFunctionBase *flushPendingElementsRef;
   };
 
 
@@ -46,6 +47,7 @@ class RootScopeHandlerExtension : public ObjTiInterface
   {
     Basic::initBindingCaches(this->owner, {
       &this->rootManagerBox,
+      &this->pendingElements
     });
   }
 
@@ -55,6 +57,9 @@ class RootScopeHandlerExtension : public ObjTiInterface
 
   public: BINDING_CACHE(rootManagerBox, Box<Core::Main::RootManager*>);
 
+  /// Root statements waiting to be built and executed in batched execution mode.
+  public: BINDING_CACHE(pendingElements, SharedList<TiObject>);
+
 
   //============================================================================
   // Member Functions
@@ -92,6 +97,32 @@ class RootScopeHandlerExtension : public ObjTiInterface
     Core::Processing::Parser *parser, Core::Processing::ParserState *state
   );
 
+  private: static void _flushPendingElements(
+    TiFunctionBase *base, TiObject *self, Core::Processing::Parser *parser, Core::Processing::ParserState *state
+  );
+
+  /// @}
+
+  /// @name Helper Functions
+  /// @{
+
+  private: static void prepareRtManagers(
+    Core::Main::RootManager *rootManager, Core::Processing::Parser *parser, Core::Processing::ParserState *state
+  );
+
+  /**
+   * @brief Check whether the execution of the given root element can be deferred.
+   *
+   * Only plain statements can be deferred. Definitions and use statements
+   * change how the pending statements are built, evals and macros run code
+   * while the AST is processed, and statements that use the Core or Spp
+   * modules, like dynamic imports, can change how the following statements
+   * are built. None of these can be batched with other statements.
+   */
+  private: static Bool isDeferrable(TiObject *element, Core::Data::Seeker *seeker, Core::Data::Ast::Scope *root);
+
+  private: static Bool isExecutionBarrier(TiObject *obj, Core::Data::Seeker *seeker, Core::Data::Ast::Scope *root);
+
   /// @}
 
 }; // class
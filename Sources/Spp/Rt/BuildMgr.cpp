@@ -21,7 +21,9 @@ void BuildMgr::initBindingCaches()
 {
   Basic::initBindingCaches(this, {
     &this->dumpLlvmIrForElement,
-    &this->buildObjectFileForElement
+    &this->buildObjectFileForElement,
+    &this->setOptimizationLevel,
+    &this->getOptimizationLevel
   });
 }
 
@@ -30,6 +32,8 @@ void BuildMgr::initBindings()
 {
   this->dumpLlvmIrForElement = &BuildMgr::_dumpLlvmIrForElement;
   this->buildObjectFileForElement = &BuildMgr::_buildObjectFileForElement;
+  this->setOptimizationLevel = &BuildMgr::_setOptimizationLevel;
+  this->getOptimizationLevel = &BuildMgr::_getOptimizationLevel;
 }
 
 
@@ -38,6 +42,8 @@ void BuildMgr::initializeRuntimePointers(CodeGen::GlobalItemRepo *globalItemRepo
   globalItemRepo->addItem(S("Spp.buildMgr"), sizeof(void*), &buildMgr);
   globalItemRepo->addItem(S("Spp_BuildMgr_dumpLlvmIrForElement"), (void*)&BuildMgr::_dumpLlvmIrForElement);
   globalItemRepo->addItem(S("Spp_BuildMgr_buildObjectFileForElement"), (void*)&BuildMgr::_buildObjectFileForElement);
+  globalItemRepo->addItem(S("Spp_BuildMgr_setOptimizationLevel"), (void*)&BuildMgr::_setOptimizationLevel);
+  globalItemRepo->addItem(S("Spp_BuildMgr_getOptimizationLevel"), (void*)&BuildMgr::_getOptimizationLevel);
 }
 
 
@@ -59,4 +65,20 @@ Bool BuildMgr::_buildObjectFileForElement(TiObject *self, TiObject *element, Cha
   );
 }
 
+
+void BuildMgr::_setOptimizationLevel(TiObject *self, Int level)
+{
+  PREPARE_SELF(buildMgr, BuildMgr);
+  if (level < 0) level = 0;
+  else if (level > 3) level = 3;
+  buildMgr->outputBuildManager->getTargetGenerator()->setOptimizationLevel(level);
+}
+
+
+Int BuildMgr::_getOptimizationLevel(TiObject *self)
+{
+  PREPARE_SELF(buildMgr, BuildMgr);
+  return buildMgr->outputBuildManager->getTargetGenerator()->getOptimizationLevel();
+}
+
 } // namespace
@@ -107,6 +107,12 @@ class BuildMgr : public TiObject, public DynamicBinding, public DynamicInterfaci
   public: METHOD_BINDING_CACHE(buildObjectFileForElement, Bool, (TiObject*, Char const*));
   public: static Bool _buildObjectFileForElement(TiObject *self, TiObject *element, Char const *objectFilename);
 
+  public: METHOD_BINDING_CACHE(setOptimizationLevel, void, (Int));
+  public: static void _setOptimizationLevel(TiObject *self, Int level);
+
+  public: METHOD_BINDING_CACHE(getOptimizationLevel, Int);
+  public: static Int _getOptimizationLevel(TiObject *self);
+
   /// @}
 
 }; // class
@@ -0,0 +1,154 @@
+/**
+ * @file Tests/benchmarks.cpp
+ * Contains the micro benchmarks.
+ *
+ * @copyright Copyright (C) 2020 Rafid Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/alusus_license_1_0>.
+ */
+//==============================================================================
+
+// Alusus header files
+#include <core.h>
+#include "benchmarks.h"
+
+// System headers
+#include <chrono>
+
+using namespace Core::Data;
+
+namespace Tests
+{
+
+/// Run the given operation on every node for the given number of rounds and print the time per operation.
+template <class F> void runBenchmark(
+  Char const *title, std::vector<TiObject*> const &nodes, Word rounds, F const &operation
+) {
+  Word matches = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (Word round = 0; round < rounds; ++round) {
+    for (auto node : nodes) {
+      if (operation(node)) ++matches;
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+  auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+  Double count = static_cast<Double>(rounds) * nodes.size();
+  std::cout << "  " << title << ": " << (ns / count) << " ns/op (" << matches << " matches)" << std::endl;
+}
+
+
+/**
+ * @brief Create a scope with a mix of the node types found in a typical AST.
+ * As done by the parser, each definition and the nodes parsed from the same
+ * token share a single source location record.
+ */
+SharedPtr<Ast::Scope> createSampleScope()
+{
+  auto scope = Ast::Scope::create();
+  for (Int i = 0; i < 50; ++i) {
+    auto sl = newSharedObject<SourceLocationRecord>(SOURCE_FILE_TABLE->getFileId(S("sample")), i + 1, 1);
+    auto first = Ast::Identifier::create({ {S("value"), TiStr(S("a"))} });
+    first->setSourceLocation(sl);
+    auto link = Ast::LinkOperator::create({ {S("type"), TiStr(S("."))} }, {
+      {S("first"), first},
+      {S("second"), Ast::Identifier::create({ {S("value"), TiStr(S("b"))} })}
+    });
+    link->setSourceLocation(sl);
+    auto def = Ast::Definition::create({ {S("name"), TiStr(S("def"))} });
+    def->setTarget(Ast::ParamPass::create({}, {
+      {S("operand"), link},
+      {S("param"), Ast::IntegerLiteral::create({ {S("value"), TiStr(S("1"))} })}
+    }));
+    def->setSourceLocation(sl);
+    scope->add(def);
+    scope->add(Ast::Bridge::create());
+  }
+  return scope;
+}
+
+
+/**
+ * @brief Measure the type checks and casts commonly done on AST nodes.
+ * The casts match the patterns used by the seeker and the code generators.
+ */
+void runTypeCheckBenchmark()
+{
+  auto scope = createSampleScope();
+
+  // Collect all the nodes in the tree.
+  std::vector<TiObject*> nodes;
+  std::vector<TiObject*> stack = { scope.get() };
+  while (!stack.empty()) {
+    auto obj = stack.back();
+    stack.pop_back();
+    nodes.push_back(obj);
+    auto container = ti_cast<Containing<TiObject>>(obj);
+    if (container != 0) {
+      for (Int i = 0; i < container->getElementCount(); ++i) {
+        if (container->getElement(i) != 0) stack.push_back(container->getElement(i));
+      }
+    }
+  }
+
+  Word rounds = 20000;
+  std::cout << "Type checks on " << nodes.size() << " AST nodes:" << std::endl;
+  runBenchmark(S("isA<Identifier>"), nodes, rounds, [](TiObject *obj) {
+    return obj->isA<Ast::Identifier>();
+  });
+  runBenchmark(S("isDerivedFrom<Node>"), nodes, rounds, [](TiObject *obj) {
+    return obj->isDerivedFrom<Node>();
+  });
+  runBenchmark(S("ti_cast<Ast::Text>"), nodes, rounds, [](TiObject *obj) {
+    return ti_cast<Ast::Text>(obj) != 0;
+  });
+  runBenchmark(S("ti_cast<Ast::Definition>"), nodes, rounds, [](TiObject *obj) {
+    return ti_cast<Ast::Definition>(obj) != 0;
+  });
+  runBenchmark(S("ti_cast<Containing<TiObject>>"), nodes, rounds, [](TiObject *obj) {
+    return ti_cast<Containing<TiObject>>(obj) != 0;
+  });
+  runBenchmark(S("ti_cast<MapContaining<TiObject>>"), nodes, rounds, [](TiObject *obj) {
+    return ti_cast<MapContaining<TiObject>>(obj) != 0;
+  });
+  runBenchmark(S("ti_cast<Ast::MetaHaving>"), nodes, rounds, [](TiObject *obj) {
+    return ti_cast<Ast::MetaHaving>(obj) != 0;
+  });
+  runBenchmark(S("ti_cast<Binding>"), nodes, rounds, [](TiObject *obj) {
+    return ti_cast<Binding>(obj) != 0;
+  });
+}
+
+
+/**
+ * @brief Measure cloning a scope the way templates are instantiated.
+ * Each clone is given the location of the instantiation, which is pushed
+ * onto the locations of the cloned nodes.
+ */
+void runCloneBenchmark()
+{
+  auto scope = createSampleScope();
+  auto sl = newSharedObject<SourceLocationRecord>(SOURCE_FILE_TABLE->getFileId(S("instance")), 1, 1);
+  Word rounds = 2000;
+  std::vector<SharedPtr<Ast::Scope>> clones;
+  clones.reserve(rounds);
+  auto start = std::chrono::steady_clock::now();
+  for (Word round = 0; round < rounds; ++round) {
+    clones.push_back(Ast::clone(scope, sl.get()));
+  }
+  auto end = std::chrono::steady_clock::now();
+  auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+  std::cout << "Cloning:" << std::endl;
+  std::cout << "  clone with source location: " << (ns / 1000.0 / rounds) << " us/clone" << std::endl;
+}
+
+
+void runBenchmarks()
+{
+  runTypeCheckBenchmark();
+  runCloneBenchmark();
+}
+
+} // namespace
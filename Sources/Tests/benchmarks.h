@@ -0,0 +1,28 @@
+/**
+ * @file Tests/benchmarks.h
+ * Contains the declarations of the micro benchmarks.
+ *
+ * @copyright Copyright (C) 2020 Rafid Khalid Abdullah
+ *
+ * @license This file is released under Alusus Public License, Version 1.0.
+ * For details on usage and copying conditions read the full license in the
+ * accompanying license file or at <https://alusus.org/alusus_license_1_0>.
+ */
+//==============================================================================
+
+#ifndef TESTS_BENCHMARKS_H
+#define TESTS_BENCHMARKS_H
+
+namespace Tests
+{
+
+/**
+ * @brief Run the micro benchmarks and print their timings.
+ * These are run instead of the end-to-end tests when the ALUSUS_TEST_BENCHMARK
+ * environment variable is set.
+ */
+void runBenchmarks();
+
+} // namespace
+
+#endif
@@ -13,6 +13,7 @@
 #include <stdlib.h>
 // Alusus header files
 #include <core.h>
+#include "benchmarks.h"
 
 // System headers
 #include <dirent.h>
@@ -292,6 +293,11 @@ int main(int argc, char **argv)
   if (resultFilename.back() != '/') resultFilename += "/";
   resultFilename += "AlususEndToEndTest.txt";
 
+  if (getenv(S("ALUSUS_TEST_BENCHMARK")) != 0) {
+    runBenchmarks();
+    return EXIT_SUCCESS;
+  }
+
   auto ret = EXIT_SUCCESS;
   if (!runEndToEndTests("./Core")) ret = EXIT_FAILURE;
   if (!runEndToEndTests("./Spp")) ret = EXIT_FAILURE;